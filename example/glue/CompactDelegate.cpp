@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (c) 2017, 2017 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omr.h"
+#include "omrhashtable.h"
+
+#include "CompactDelegate.hpp"
+#include "CompactScheme.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "MarkMap.hpp"
+#include "omrExampleVM.hpp"
+#include "OMRVMThreadListIterator.hpp"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
+#endif /* OMR_GC_MODRON_SCAVENGER */
+#include "Task.hpp"
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+
+void
+MM_CompactDelegate::masterSetupForGC(MM_EnvironmentBase *env)
+{
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->scavengerEnabled) {
+		MM_SublistPuddle *puddle = NULL;
+		GC_SublistIterator remSetIterator(&extensions->rememberedSet);
+		while (NULL != (puddle = remSetIterator.nextList())) {
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+				if (!_markMap->isBitSet(*slotPtr)) {
+					remSetSlotIterator.removeSlot();
+				}
+			}
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+}
+
+void
+MM_CompactDelegate::fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme)
+{
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseSingleThread(env, UNIQUE_ID)) {
+		J9HashTableState state;
+		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+		if (NULL != omrVM->rootTable) {
+			RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+			while (NULL != rootEntry) {
+				rootEntry->rootPtr = compactScheme->getForwardingPtr(rootEntry->rootPtr);
+				rootEntry = (RootEntry *)hashTableNextDo(&state);
+			}
+		}
+		if (NULL != omrVM->objectTable) {
+			ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+			while (NULL != objectEntry) {
+				objectEntry->objPtr = compactScheme->getForwardingPtr(objectEntry->objPtr);
+				objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+			}
+		}
+		OMR_VMThread *walkThread = NULL;
+		GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+		while (NULL != (walkThread = threadListIterator.nextOMRVMThread())) {
+			walkThread->_savedObject1 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject1);
+			walkThread->_savedObject2 = compactScheme->getForwardingPtr((omrobjectptr_t)walkThread->_savedObject2);
+		}
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		if (extensions->scavengerEnabled) {
+			MM_SublistPuddle *puddle = NULL;
+			GC_SublistIterator remSetIterator(&extensions->rememberedSet);
+			while (NULL != (puddle = remSetIterator.nextList())) {
+				GC_SublistSlotIterator remSetSlotIterator(puddle);
+				omrobjectptr_t *slotPtr = NULL;
+				while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+					*slotPtr = compactScheme->getForwardingPtr(*slotPtr);
+				}
+			}
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+#endif /* OMR_GC_MODRON_COMPACTION */
@@ -77,19 +77,27 @@ public:
 	void
 	verifyHeap(MM_EnvironmentBase *env, MM_MarkMap *markMap) { }
 
+	/**
+	 * Update the root table, the object table, the thread saved objects and the
+	 * remembered set to the new locations of the objects they refer to.
+	 */
 	void
-	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme) { }
+	fixupRoots(MM_EnvironmentBase *env, MM_CompactScheme *compactScheme);
 
 	void
 	workerCleanupAfterGC(MM_EnvironmentBase *env) { }
 
+	/**
+	 * Drop remembered set entries for objects that did not survive the mark, while
+	 * the mark map is still intact. Their slots could not be forwarded after the move.
+	 */
 	void
-	masterSetupForGC(MM_EnvironmentBase *env) { }
+	masterSetupForGC(MM_EnvironmentBase *env);
 
 	MM_CompactDelegate()
-		: _compactScheme(NULL)
+		: _omrVM(NULL)
+		, _compactScheme(NULL)
 		, _markMap(NULL)
-		, _omrVM(NULL)
 	{}
 };
 
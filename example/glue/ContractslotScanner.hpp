@@ -19,6 +19,9 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "omrExampleVM.hpp"
+#include "omrhashtable.h"
+
 #include "Base.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -26,6 +29,7 @@
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
 #include "ModronAssertions.h"
+#include "OMRVMThreadListIterator.hpp"
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
@@ -60,10 +64,34 @@ public:
 		}
 	}
 
+	/**
+	 * Fix up the roots referring into the moved range. Heap slots have already been fixed up by the heap walk.
+	 */
 	void
 	scanAllSlots(MM_EnvironmentBase *env)
 	{
-		Assert_MM_unimplemented();
+		J9HashTableState state;
+		OMR_VM_Example *omrVM = (OMR_VM_Example *)env->getOmrVM()->_language_vm;
+		if (NULL != omrVM->rootTable) {
+			RootEntry *rootEntry = (RootEntry *)hashTableStartDo(omrVM->rootTable, &state);
+			while (NULL != rootEntry) {
+				doSlot(&rootEntry->rootPtr);
+				rootEntry = (RootEntry *)hashTableNextDo(&state);
+			}
+		}
+		if (NULL != omrVM->objectTable) {
+			ObjectEntry *objectEntry = (ObjectEntry *)hashTableStartDo(omrVM->objectTable, &state);
+			while (NULL != objectEntry) {
+				doSlot(&objectEntry->objPtr);
+				objectEntry = (ObjectEntry *)hashTableNextDo(&state);
+			}
+		}
+		OMR_VMThread *walkThread;
+		GC_OMRVMThreadListIterator threadListIterator(env->getOmrVM());
+		while((walkThread = threadListIterator.nextOMRVMThread()) != NULL) {
+			doSlot((omrobjectptr_t *)&walkThread->_savedObject1);
+			doSlot((omrobjectptr_t *)&walkThread->_savedObject2);
+		}
 	}
 
 	/* TODO remove this function as it is Java specific */
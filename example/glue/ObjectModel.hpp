@@ -67,6 +67,21 @@ public:
 	 */
 	virtual void tearDown(MM_GCExtensionsBase *extensions) {}
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	/**
+	 * Determine the consumed size of an object as it was before it was moved. Objects in this example
+	 * do not grow when moved, so this is the same as the size of the copy.
+	 *
+	 * @param[in] objectPtr points to the moved copy of the object
+	 * @return the consumed size of the object before it was moved, in bytes
+	 */
+	MMINLINE uintptr_t
+	getConsumedSizeInBytesWithHeaderBeforeMove(omrobjectptr_t objectPtr)
+	{
+		return getConsumedSizeInBytesWithHeader(objectPtr);
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+
 	/**
 	 * Constructor.
 	 */
@@ -222,4 +222,18 @@ MM_ScavengerDelegate::fixupDestroyedSlot(MM_EnvironmentBase *env, MM_ForwardedHe
 }
 #endif /* defined (OMR_GC_COMPRESSED_POINTERS) */
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+void
+MM_ScavengerDelegate::switchConcurrentForThread(MM_EnvironmentBase *env)
+{
+	/* No language specific thread local resources to enable or disable in this example */
+}
+
+void
+MM_ScavengerDelegate::fixupIndirectObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	/* No indirect object references in this example */
+}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -30,6 +30,7 @@ CONFIGURE_ARGS += \
   --enable-OMR_GC_SEGREGATED_HEAP \
   --enable-OMR_GC_MODRON_SCAVENGER \
   --enable-OMR_GC_MODRON_CONCURRENT_MARK \
+  --enable-OMR_GC_MODRON_COMPACTION \
   --enable-OMR_GC_VLHGC \
   --enable-OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD \
   --enable-OMR_THR_CUSTOM_SPIN_OPTIONS \
@@ -28,6 +28,7 @@
 #include "omrgc.h"
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
+#include "VerboseEventConverter.hpp"
 #include "VerboseWriterChain.hpp"
 
 //#define OMRGCTEST_PRINTFILE
@@ -43,21 +44,65 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_workStealing_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_scanPrefetch_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_heapPreTouch_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_binaryLogging_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_allocationSampling_config.xml"
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_compactIncremental_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+                        , "fvtest/gctest/configuration/global_GC_metadataPages_config.xml"
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_dynamicBreadthFirst_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_adaptiveThreading_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_spinPark_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_numaAware_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_tlhBatch_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_preZero_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_survivalCensus_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_pauseTarget_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_pauseTargetContraction_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_rememberedSetOverflow_config.xml"
+#endif
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+                        , "fvtest/gctest/configuration/scavenger_GC_concurrentHealing_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_mutation_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_mutation_config.xml"
+                        , "fvtest/gctest/configuration/segregated_GC_lazySweep_config.xml"
+                        , "fvtest/gctest/configuration/segregated_GC_allocationContextPerCPU_config.xml"
 #endif
                         };
 
-const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+/* The pause_* configs form the pause-time benchmark: they run one workload under each low-pause policy so the pause percentiles reported by omrperfgctest can be compared. */
+const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml"
+								, "perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+								, "perftest/gctest/configuration/pause_gencon_config.xml"
+								, "perftest/gctest/configuration/replay_gencon_config.xml"
+#endif
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+								, "perftest/gctest/configuration/pause_concurrentScavenger_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+								, "perftest/gctest/configuration/pause_optavgpause_config.xml"
+								, "perftest/gctest/configuration/replay_optavgpause_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+								, "perftest/gctest/configuration/replay_segregated_config.xml"
+#endif
+								};
 void
 GCConfigTest::SetUp()
 {
@@ -76,10 +121,6 @@ GCConfigTest::SetUp()
 	rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
 	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_Thread_Init failed, rc=" << rc;
 
-	/* Kick off the dispatcher threads */
-	rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
-	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
-
 	/* Instantiate collector interface */
 	env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
 	cli = startupManager.createCollectorLanguageInterface(env);
@@ -116,6 +157,39 @@ GCConfigTest::SetUp()
 	verboseManager->enableVerboseGC();
 	verboseManager->setInitializedTime(omrtime_hires_clock());
 
+	/* Report the initialized GC as a VM does once verbose GC is enabled, so that its stanza can be verified */
+	{
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		TRIGGER_J9HOOK_MM_OMR_INITIALIZED(
+			extensions->omrHookInterface,
+			exampleVM->_omrVMThread,
+			omrtime_hires_clock(),
+			optionNode.attribute("GCPolicy").as_string("optavgpause"),
+			0, /* unused */
+			extensions->memoryMax,
+			extensions->initialMemorySize,
+			omrsysinfo_get_physical_memory(),
+			omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE),
+			extensions->gcThreadCount,
+			omrsysinfo_get_CPU_architecture(),
+			omrsysinfo_get_OS_type(),
+			omrsysinfo_get_OS_version(),
+			exampleVM->_omrVM->_compressedPointersShift,
+			0, 0, 0, 0, 0, /* Metronome beat, time window, target utilization, trigger and headroom */
+			extensions->requestedPageSize,
+			"not used",
+			extensions->requestedPageSize,
+			"not used",
+			0, /* NUMA nodes */
+			extensions->regionSize,
+			0, /* region count */
+			0); /* arraylet leaf size */
+	}
+
+	/* Kick off the dispatcher threads once verbose GC is enabled, so that the startup heap pre-touch is reported */
+	rc = OMR_GC_InitializeDispatcherThreads(exampleVM->_omrVMThread);
+	ASSERT_EQ(OMR_ERROR_NONE, rc) << "Setup(): OMR_GC_InitializeDispatcherThreads failed, rc=" << rc;
+
 	/* Initialize root table */
 	exampleVM->rootTable = hashTableNew(
 			exampleVM->_omrVM->_runtime->_portLibrary, OMR_GET_CALLSITE(), 0, sizeof(RootEntry), 0, 0, OMRMEM_CATEGORY_MM,
@@ -297,7 +371,7 @@ GCConfigTest::parseObjectType(pugi::xml_node node)
 }
 
 ObjectEntry *
-GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
+GCConfigTest::allocateHelper(const char *objName, uintptr_t size, uintptr_t allocationSite)
 {
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
 
@@ -309,12 +383,14 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
 	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
 			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+	noGc->getAllocateDescription()->setAllocationSite(allocationSite);
 	objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, noGc);
 
 	if (NULL == objEntry.objPtr) {
 		gcTestEnv->log("No free memory to allocate %s of size 0x%llx, GC start.\n", objName, size);
 		MM_ObjectAllocationModel *withGc = new(objectAllocationModelSpace)
 				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+		withGc->getAllocateDescription()->setAllocationSite(allocationSite);
 		objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, withGc);
 	}
 
@@ -353,7 +429,10 @@ GCConfigTest::createObject(const char *namePrefix, OMRGCObjectType objType, int3
 		gcTestEnv->log(LEVEL_VERBOSE, "Found object %s in object table.\n", objEntry->name);
 		omrmem_free_memory(objName);
 	} else {
-		objEntry = allocateHelper(objName, size);
+		/* objects created from the same name prefix share an allocation site */
+		ObjectEntry siteEntry;
+		siteEntry.name = namePrefix;
+		objEntry = allocateHelper(objName, size, objectTableHashFn(&siteEntry, NULL));
 		if (NULL != objEntry) {
 			/* Keep count of the new allocated non-garbage object size for garbage insertion. If the object exists in objectTable, its size is ignored. */
 			if ((ROOT == objType) || (NORMAL == objType)) {
@@ -688,7 +767,7 @@ GCConfigTest::removeObjectFromParentSlot(const char *name, ObjectEntry *parentEn
 
 	while (currentSlot < endSlot) {
 		GC_SlotObject slotObject(exampleVM->_omrVM, currentSlot);
-		if (objEntry->objPtr == slotObject.readReferenceFromSlot()) {
+		if (objEntry->objPtr == standardReadBarrierLoad(exampleVM->_omrVMThread, parentEntry->objPtr, currentSlot)) {
 			gcTestEnv->log(LEVEL_VERBOSE, "Remove object %s(%p[0x%llx]) from parent %s(%p[0x%llx]) slot %p.\n", name, objEntry->objPtr, objEntry->objPtr->header.raw(), parentEntry->name, parentEntry->objPtr, parentEntry->objPtr->header.raw(), slotObject.readAddressFromSlot());
 			slotObject.writeReferenceToSlot(NULL);
 			rt = 0;
@@ -794,6 +873,190 @@ done:
 	return rt;
 }
 
+int32_t
+GCConfigTest::replayAllocate(pugi::xml_node node, const char *namePrefixStr, int32_t iteration)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(exampleVM->_omrVM);
+	int32_t rt = 0;
+	AttributeElem *numOfFieldsElem = NULL;
+	char stepPrefix[MAX_NAME_LENGTH];
+
+	const char *idStr = node.attribute("id").value();
+	const char *numOfFieldsStr = node.attribute(xs.numOfFields).value();
+	int32_t count = node.attribute("count").as_int(1);
+
+	if ((0 == strcmp(idStr, "")) || (0 == strcmp(numOfFieldsStr, ""))) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: please specify id and numOfFields for mutation allocate step.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	rt = parseAttribute(&numOfFieldsElem, numOfFieldsStr);
+	OMRGCTEST_CHECK_RT(rt);
+
+	omrstr_printf(stepPrefix, MAX_NAME_LENGTH, "%s_%s", namePrefixStr, idStr);
+	for (int32_t i = 0; i < count; i++) {
+		uintptr_t sizeCalculated = numOfFieldsElem->value * sizeof(fomrobject_t) + sizeof(uintptr_t);
+		ObjectEntry *objectEntry = createObject(stepPrefix, ROOT, iteration, i, sizeCalculated);
+		if (NULL == objectEntry) {
+			rt = 1;
+			goto done;
+		}
+		numOfFieldsElem = numOfFieldsElem->linkNext;
+
+		/* Trace objects stay in the root set until their lifetime ends, see replayRelease(). */
+		RootEntry rEntry;
+		rEntry.name = objectEntry->name;
+		rEntry.rootPtr = objectEntry->objPtr;
+		if (NULL == hashTableAdd(exampleVM->rootTable, &rEntry)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to add new root entry to root table!\n", __FILE__, __LINE__);
+			goto done;
+		}
+	}
+
+done:
+	freeAttributeList(numOfFieldsElem);
+	return rt;
+}
+
+int32_t
+GCConfigTest::replayStore(pugi::xml_node node, const char *namePrefixStr, int32_t iteration)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(exampleVM->_omrVM);
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+	int32_t rt = 0;
+
+	const char *parentStr = node.attribute("parent").value();
+	const char *childStr = node.attribute("child").value();
+	int32_t parentIteration = iteration - node.attribute("parentAge").as_int(0);
+	int32_t childIteration = iteration - node.attribute("childAge").as_int(0);
+
+	if ((0 == strcmp(parentStr, "")) || (0 == strcmp(childStr, ""))) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: please specify parent and child for mutation store step.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	if ((0 > parentIteration) || (0 > childIteration)) {
+		/* aged objects do not exist yet in the first iterations of the trace */
+		goto done;
+	}
+
+	/* Each child instance is stored into the parent instance with the same index, or into the first
+	 * parent instance if there are fewer parents than children. Only objects that are still in the
+	 * root set are reachable by the mutator, so both ends of the store are looked up there. */
+	for (int32_t i = 0; ; i++) {
+		char childName[MAX_NAME_LENGTH];
+		char parentName[MAX_NAME_LENGTH];
+		omrstr_printf(childName, MAX_NAME_LENGTH, "%s_%s_%d_%d", namePrefixStr, childStr, childIteration, i);
+		if (NULL == findRoot(childName)) {
+			if (0 == i) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: object %s is not live at iteration %d.\n", __FILE__, __LINE__, childName, iteration);
+			}
+			break;
+		}
+		omrstr_printf(parentName, MAX_NAME_LENGTH, "%s_%s_%d_%d", namePrefixStr, parentStr, parentIteration, i);
+		if (NULL == findRoot(parentName)) {
+			omrstr_printf(parentName, MAX_NAME_LENGTH, "%s_%s_%d_%d", namePrefixStr, parentStr, parentIteration, 0);
+			if (NULL == findRoot(parentName)) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: object %s is not live at iteration %d.\n", __FILE__, __LINE__, parentName, iteration);
+				break;
+			}
+		}
+
+		ObjectEntry *childEntry = find(childName);
+		ObjectEntry *parentEntry = find(parentName);
+		if ((NULL == childEntry) || (NULL == parentEntry)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Could not find object %s or %s in hash table.\n", __FILE__, __LINE__, parentName, childName);
+			break;
+		}
+
+		/* Once every field of the parent holds a reference, further stores overwrite them starting from the first field. */
+		uintptr_t size = extensions->objectModel.getConsumedSizeInBytesWithHeader(parentEntry->objPtr);
+		fomrobject_t *firstSlot = (fomrobject_t *)parentEntry->objPtr + 1;
+		fomrobject_t *endSlot = (fomrobject_t *)((uint8_t *)parentEntry->objPtr + size);
+		if ((uintptr_t)parentEntry->numOfRef >= (uintptr_t)(endSlot - firstSlot)) {
+			parentEntry->numOfRef = 0;
+		}
+		rt = attachChildEntry(parentEntry, childEntry);
+		if (0 != rt) {
+			break;
+		}
+	}
+
+done:
+	return rt;
+}
+
+int32_t
+GCConfigTest::replayRelease(pugi::xml_node node, const char *namePrefixStr, int32_t iteration)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(exampleVM->_omrVM);
+	int32_t rt = 0;
+	pugi::xml_attribute lifetimeAttr = node.attribute("lifetime");
+
+	/* objects without a lifetime stay live until the end of the test */
+	if (!lifetimeAttr.empty()) {
+		int32_t birthIteration = iteration - lifetimeAttr.as_int();
+		int32_t count = node.attribute("count").as_int(1);
+		for (int32_t i = 0; (0 <= birthIteration) && (i < count); i++) {
+			char objName[MAX_NAME_LENGTH];
+			omrstr_printf(objName, MAX_NAME_LENGTH, "%s_%s_%d_%d", namePrefixStr, node.attribute("id").value(), birthIteration, i);
+			rt = removeObjectFromRootTable(objName);
+			OMRGCTEST_CHECK_RT(rt);
+		}
+	}
+
+done:
+	return rt;
+}
+
+/**
+ * Replay an allocation/mutation trace. The steps nested in the mutation node are executed in order once
+ * per iteration:
+ *   <allocate id="a" numOfFields="16,32" count="4" lifetime="2"/> allocates count root objects named
+ *     <namePrefix>_<id>_<iteration>_<n>, cycling through the numOfFields list. The objects are dropped from
+ *     the root set at the end of iteration + lifetime; without a lifetime they live until the end of the test.
+ *   <store parent="a" child="b" parentAge="2" childAge="0"/> stores references to the child objects allocated
+ *     childAge iterations ago into the parent objects allocated parentAge iterations ago.
+ */
+int32_t
+GCConfigTest::mutationReplay(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	const char *namePrefixStr = node.attribute(xs.namePrefix).value();
+	int32_t iterations = node.attribute("iterations").as_int(1);
+
+	if (0 == strcmp(namePrefixStr, "")) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: please specify namePrefix for mutation.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	for (int32_t iteration = 0; iteration < iterations; iteration++) {
+		for (pugi::xml_node stepNode = node.first_child(); stepNode; stepNode = stepNode.next_sibling()) {
+			if (0 == strcmp(stepNode.name(), "allocate")) {
+				rt = replayAllocate(stepNode, namePrefixStr, iteration);
+			} else if (0 == strcmp(stepNode.name(), "store")) {
+				rt = replayStore(stepNode, namePrefixStr, iteration);
+			} else {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid XML input: unrecognized mutation step \"%s\".\n", __FILE__, __LINE__, stepNode.name());
+			}
+			OMRGCTEST_CHECK_RT(rt);
+		}
+		for (pugi::xml_node stepNode = node.child("allocate"); stepNode; stepNode = stepNode.next_sibling("allocate")) {
+			rt = replayRelease(stepNode, namePrefixStr, iteration);
+			OMRGCTEST_CHECK_RT(rt);
+		}
+	}
+
+done:
+	return rt;
+}
+
 #if defined(OMRGCTEST_PRINTFILE)
 void
 printFile(const char *name)
@@ -809,6 +1072,40 @@ printFile(const char *name)
 }
 #endif
 
+/**
+ * Regenerate the XML stanzas of a -Xgc:binaryLogging log the way the verbosegcconvert tool does,
+ * so that a binary log is verified against the same xqueries as an XML one.
+ */
+static bool
+loadBinaryVerboseLog(pugi::xml_document *verboseDoc, const char *name)
+{
+	bool loaded = false;
+	FILE *in = fopen(name, "rb");
+	FILE *converted = tmpfile();
+	if ((NULL != in) && (NULL != converted)) {
+		VerboseEventStreamHeader header;
+		if (MM_VerboseEventConverter::CONVERTED == MM_VerboseEventConverter::convert(in, converted, &header)) {
+			OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+			size_t length = (size_t)ftell(converted);
+			char *buffer = (char *)omrmem_allocate_memory(length, OMRMEM_CATEGORY_MM);
+			if (NULL != buffer) {
+				rewind(converted);
+				if (length == fread(buffer, 1, length, converted)) {
+					loaded = (bool)verboseDoc->load_buffer(buffer, length);
+				}
+				omrmem_free_memory(buffer);
+			}
+		}
+	}
+	if (NULL != in) {
+		fclose(in);
+	}
+	if (NULL != converted) {
+		fclose(converted);
+	}
+	return loaded;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -829,7 +1126,16 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 	/* Loop through multiple files if rolling log is enabled */
 	do {
 		pugi::xml_document verboseDoc;
-		if (0 == numOfFiles) {
+		if (env->getExtensions()->binaryLogging) {
+			/* the flusher thread writes asynchronously, close the stream to get every record into the file */
+			verboseManager->closeStreams(env);
+			if (!loadBinaryVerboseLog(&verboseDoc, verboseFile)) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to convert binary verbose log %s.\n", __FILE__, __LINE__, verboseFile);
+				goto done;
+			}
+			gcTestEnv->log("Parsing converted binary verbose log %s:\n", verboseFile);
+		} else if (0 == numOfFiles) {
 			verboseDoc.load_file(verboseFile);
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
@@ -1052,7 +1358,11 @@ TEST_P(GCConfigTest, test)
 			rt = triggerOperation(configChild.first_child());
 			ASSERT_EQ(0, rt) << "Failed to perform gc operation.";
 		} else if (0 == strcmp(configChild.name(), "mutation")) {
-			/*TODO*/
+			gcTestEnv->log("\n+++++++++++++++++++++++++++++Mutation+++++++++++++++++++++++++++\n");
+			int64_t startTime = omrtime_current_time_millis();
+			rt = mutationReplay(configChild);
+			ASSERT_EQ(0, rt) << "Failed to replay mutation trace.";
+			gcTestEnv->log("Time elapsed in mutation: %lld ms\n", (omrtime_current_time_millis() - startTime));
 		} else {
 			FAIL() << "Invalid XML input: unrecognized XML node \"" << configChild.name() << "\" in configuration file.";
 		}
@@ -29,6 +29,7 @@
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
 #include "pugixml.hpp"
+#include "StandardReadBarrier.hpp"
 #include "StartupManagerTestExample.hpp"
 #include "VerboseManager.hpp"
 
@@ -94,7 +95,7 @@ protected:
 	void freeAttributeList(AttributeElem *root);
 	int32_t parseAttribute(AttributeElem **root, const char *attrStr);
 	OMRGCObjectType parseObjectType(pugi::xml_node node);
-	ObjectEntry *allocateHelper(const char *objName, uintptr_t size);
+	ObjectEntry *allocateHelper(const char *objName, uintptr_t size, uintptr_t allocationSite);
 	ObjectEntry *createObject(const char *namePrefix, OMRGCObjectType objType, int32_t depth, int32_t nthInRow, uintptr_t size);
 	int32_t createFixedSizeTree(ObjectEntry **objectEntry, const char *namePrefixStr, OMRGCObjectType objType, uintptr_t totalSize, uintptr_t objSize, int32_t breadth);
 	int32_t processObjNode(pugi::xml_node node, const char *namePrefixStr, OMRGCObjectType objType, AttributeElem *numOfFieldsElem, AttributeElem *breadthElem, int32_t depth);
@@ -104,6 +105,10 @@ protected:
 	int32_t removeObjectFromObjectTable(const char *name);
 	int32_t removeObjectFromParentSlot(const char *name, ObjectEntry *parentEntry);
 	int32_t allocationWalker(pugi::xml_node node);
+	int32_t replayAllocate(pugi::xml_node node, const char *namePrefixStr, int32_t iteration);
+	int32_t replayStore(pugi::xml_node node, const char *namePrefixStr, int32_t iteration);
+	int32_t replayRelease(pugi::xml_node node, const char *namePrefixStr, int32_t iteration);
+	int32_t mutationReplay(pugi::xml_node node);
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
@@ -133,7 +138,20 @@ protected:
 	{
 		ObjectEntry searchEntry;
 		searchEntry.name = name;
-		return (ObjectEntry *)hashTableFind(exampleVM->objectTable, &searchEntry);
+		ObjectEntry *foundEntry = (ObjectEntry *)hashTableFind(exampleVM->objectTable, &searchEntry);
+		if (NULL != foundEntry) {
+			/* The object table is only updated at the end of a scavenge, so load the entry through the read barrier */
+			standardRootReadBarrierLoad(exampleVM->_omrVMThread, &foundEntry->objPtr);
+		}
+		return foundEntry;
+	}
+
+	RootEntry *
+	findRoot(const char *name)
+	{
+		RootEntry searchEntry;
+		searchEntry.name = name;
+		return (RootEntry *)hashTableFind(exampleVM->rootTable, &searchEntry);
 	}
 
 	ObjectEntry *
@@ -83,7 +83,38 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
+				} else if (0 == strcmp(attr.name(), "workStealingMark")) {
+					extensions->workStealingMark = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workStealingDequeSize")) {
+					extensions->workStealingDequeSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "tlhRefreshBatchCount")) {
+					extensions->tlhRefreshBatchCount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDepth")) {
+					extensions->markingPrefetchDepth = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "heapMapPageSize")) {
+					extensions->heapMapPageSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "cardTablePageSize")) {
+					extensions->cardTablePageSize = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "heapPreTouch")) {
+					extensions->heapPreTouch = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "binaryLogging")) {
+					extensions->binaryLogging = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationSamplingInterval")) {
+					extensions->allocationSamplingInterval = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "allocationSiteTopK")) {
+					extensions->allocationSiteTopK = atoi(attr.value());
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+				} else if (0 == strcmp(attr.name(), "batchClearTLH")) {
+					extensions->batchClearTLH = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerPreZeroAllocateSpace")) {
+					extensions->scavengerPreZeroAllocateSpace = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+				} else if (0 == strcmp(attr.name(), "adaptiveGCThreading")) {
+					extensions->adaptiveGCThreading = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "gcThreadParkSpinCount")) {
+					extensions->gcThreadParkSpinCount = atoi(attr.value());
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,8 +122,12 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+						_useSegregatedGC = true;
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, optavgpause or segregated): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,12 +136,74 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					extensions->compactOnGlobalGC = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+					extensions->noCompactOnGlobalGC = !extensions->compactOnGlobalGC;
+				} else if (0 == strcmp(attr.name(), "compactIncremental")) {
+					extensions->compactIncremental = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "compactIncrementalWindowPercentage")) {
+					extensions->compactIncrementalWindowPercentage = atoi(attr.value());
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "forceRememberedSetOverflow")) {
+					extensions->fvtest_forceRememberedSetOverflow = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerScanOrdering")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "breadthFirst")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "hierarchical")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "dynamicBreadthFirst")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST;
+					} else {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized scavenger scan ordering (expected breadthFirst, hierarchical or dynamicBreadthFirst): %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "scavengerDynamicBreadthFirstScanDepth")) {
+					extensions->scavengerDynamicBreadthFirstScanDepth = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerDynamicBreadthFirstHotSlots")) {
+					extensions->scavengerDynamicBreadthFirstHotSlots = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "numaAwareGencon")) {
+					extensions->numaAwareGencon = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
+				} else if (0 == strcmp(attr.name(), "scavengerSurvivalCensus")) {
+					extensions->scavengerSurvivalCensus = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerPauseTarget")) {
+					extensions->scavengerPauseTarget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerOverheadBudget")) {
+					extensions->scavengerOverheadBudget = atoi(attr.value()) / 100.0;
+				} else if (0 == strcmp(attr.name(), "concurrentScavenger")) {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+					extensions->concurrentScavenger = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentScavenger=true ignored, requires OMR_GC_CONCURRENT_SCAVENGER\n");
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+				} else if (0 == strcmp(attr.name(), "lazySweepSegregated")) {
+					extensions->lazySweepSegregated = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "segregatedAllocationContextPerCPU")) {
+					extensions->segregatedAllocationContextPerCPU = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "sizeClassSamplingInterval")) {
+					extensions->sizeClassSamplingInterval = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "sizeClassProfile")) {
+					OMRPORT_ACCESS_FROM_OMRVM(extensions->getOmrVM());
+					if (NULL != extensions->sizeClassProfile) {
+						omrmem_free_memory(extensions->sizeClassProfile);
+					}
+					extensions->sizeClassProfile = (char *)omrmem_allocate_memory(strlen(attr.value()) + 1, OMRMEM_CATEGORY_MM);
+					if (NULL == extensions->sizeClassProfile) {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: could not allocate size class profile file name\n");
+						result = false;
+					} else {
+						strcpy(extensions->sizeClassProfile, attr.value());
+					}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
@@ -116,6 +213,7 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #if defined(OMR_GC_MODRON_SCAVENGER)
 			extensions->fvtest_forceScavengerBackout &= extensions->scavengerEnabled;
 			extensions->fvtest_forcePoisonEvacuate &= extensions->scavengerEnabled;
+			extensions->fvtest_forceRememberedSetOverflow &= extensions->scavengerEnabled;
 #endif /* OMR_GC_MODRON_SCAVENGER */
 		}
 	}
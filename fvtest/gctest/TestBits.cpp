@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "Bits.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+/* more slots than the widest vector, and not a multiple of any vector width */
+const uintptr_t slotCount = 37;
+
+}
+
+TEST(TestBits, FindNonZeroSlotEmptyRange)
+{
+    uintptr_t slots[slotCount] = {0};
+    slots[0] = 1;
+
+    EXPECT_EQ(MM_Bits::findNonZeroSlot(slots, slots), slots);
+    EXPECT_EQ(MM_Bits::findNonZeroSlot(slots + 1, slots + slotCount), slots + slotCount);
+}
+
+TEST(TestBits, FindNonZeroSlotStopsAtUnalignedTop)
+{
+    /* the slot just past top is set and must neither be returned nor read into the result */
+    for (uintptr_t top = 1; top < slotCount; top++) {
+        uintptr_t slots[slotCount] = {0};
+        slots[top] = 1;
+        EXPECT_EQ(MM_Bits::findNonZeroSlot(slots, slots + top), slots + top);
+    }
+}
+
+TEST(TestBits, FindNonZeroSlotFindsEverySlot)
+{
+    for (uintptr_t start = 0; start < 8; start++) {
+        for (uintptr_t hit = start; hit < slotCount; hit++) {
+            uintptr_t slots[slotCount] = {0};
+            slots[hit] = ((uintptr_t)1) << (hit % (sizeof(uintptr_t) * 8));
+            EXPECT_EQ(MM_Bits::findNonZeroSlot(slots + start, slots + slotCount), slots + hit);
+        }
+    }
+}
+
+TEST(TestBits, FindNonZeroSlotHitInLastSlot)
+{
+    uintptr_t slots[slotCount] = {0};
+    slots[slotCount - 1] = ((uintptr_t)1) << (sizeof(uintptr_t) * 8 - 1);
+
+    EXPECT_EQ(MM_Bits::findNonZeroSlot(slots, slots + slotCount), slots + slotCount - 1);
+}
+
+TEST(TestBits, PopulationCountRange)
+{
+    uintptr_t slots[slotCount] = {0};
+    uintptr_t expected = 0;
+    for (uintptr_t i = 0; i < slotCount; i++) {
+        slots[i] = (i * 0x9E3779B9) ^ (i << 7);
+        expected += MM_Bits::populationCount(slots[i]);
+    }
+
+    EXPECT_EQ(MM_Bits::populationCount(slots, slots), 0u);
+    EXPECT_EQ(MM_Bits::populationCount(slots, slots + slotCount), expected);
+    EXPECT_EQ(MM_Bits::populationCount(slots + 1, slots + 2), MM_Bits::populationCount(slots[1]));
+
+    slots[slotCount - 1] = ~(uintptr_t)0;
+    EXPECT_EQ(MM_Bits::populationCount(slots + slotCount - 1, slots + slotCount), sizeof(uintptr_t) * 8);
+}
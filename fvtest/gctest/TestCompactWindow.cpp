@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "CompactWindow.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+enum { init = 0, end_segment = 1 };
+
+struct SubArea {
+    uintptr_t state;
+    uintptr_t fragmentedBytes;
+};
+
+}
+
+TEST(TestCompactWindow, PicksMostFragmentedRun)
+{
+    SubArea table[] = {{init, 10}, {init, 0}, {init, 50}, {init, 60}, {init, 5}, {init, 40}, {end_segment, 0}};
+
+    MM_CompactWindow window = MM_CompactWindow::select(table, 7, 2, end_segment);
+    EXPECT_EQ(window._start, 2u);
+    EXPECT_EQ(window._end, 4u);
+    EXPECT_EQ(window._fragmentedBytes, 110u);
+
+    window = MM_CompactWindow::select(table, 7, 3, end_segment);
+    EXPECT_EQ(window._start, 2u);
+    EXPECT_EQ(window._end, 5u);
+    EXPECT_EQ(window._fragmentedBytes, 115u);
+}
+
+TEST(TestCompactWindow, NeverSpansSegments)
+{
+    /* the last sub area of the first segment and the first of the second would make the best pair */
+    SubArea table[] = {{init, 5}, {init, 100}, {end_segment, 0}, {init, 100}, {init, 20}, {end_segment, 0}};
+
+    MM_CompactWindow window = MM_CompactWindow::select(table, 6, 2, end_segment);
+    EXPECT_EQ(window._start, 3u);
+    EXPECT_EQ(window._end, 5u);
+    EXPECT_EQ(window._fragmentedBytes, 120u);
+}
+
+TEST(TestCompactWindow, ShortSegmentAndTies)
+{
+    /* a window longer than a segment covers the whole segment, and equal windows keep the lowest */
+    SubArea table[] = {{init, 30}, {end_segment, 0}, {init, 10}, {init, 20}, {end_segment, 0}};
+
+    MM_CompactWindow window = MM_CompactWindow::select(table, 5, 4, end_segment);
+    EXPECT_EQ(window._start, 0u);
+    EXPECT_EQ(window._end, 1u);
+    EXPECT_EQ(window._fragmentedBytes, 30u);
+}
+
+TEST(TestCompactWindow, NoFragmentationStillSelects)
+{
+    SubArea table[] = {{init, 0}, {init, 0}, {init, 0}, {end_segment, 0}};
+
+    MM_CompactWindow window = MM_CompactWindow::select(table, 4, 2, end_segment);
+    EXPECT_FALSE(window.isEmpty());
+    EXPECT_EQ(window._start, 0u);
+    EXPECT_EQ(window._end, 1u);
+    EXPECT_EQ(window._fragmentedBytes, 0u);
+}
+
+TEST(TestCompactWindow, EmptyTable)
+{
+    SubArea table[] = {{end_segment, 0}, {end_segment, 0}};
+
+    EXPECT_TRUE(MM_CompactWindow::select(table, 2, 1, end_segment).isEmpty());
+    EXPECT_TRUE(MM_CompactWindow::select(table, 0, 1, end_segment).isEmpty());
+}
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "ConcurrentCardTable.hpp"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+namespace {
+
+/* Card table of 64 cards, slot aligned so that clean spans are skipped a slot at a time */
+struct Cards {
+    uintptr_t slots[64 / sizeof(uintptr_t)];
+
+    Cards() { memset(slots, CARD_CLEAN, sizeof(slots)); }
+    Card *at(uintptr_t index) { return (Card *)slots + index; }
+    Card *top() { return at(64); }
+};
+
+}
+
+TEST(TestConcurrentCardTable, ClaimsRunOfDirtyCards)
+{
+    Cards cards;
+    *cards.at(21) = CARD_DIRTY;
+    *cards.at(22) = CARD_DIRTY;
+    *cards.at(23) = CARD_DIRTY;
+    *cards.at(30) = CARD_DIRTY;
+
+    Card *runTop = NULL;
+    EXPECT_EQ(MM_ConcurrentCardTable::findDirtyCardRun(cards.at(0), cards.top(), CARD_DIRTY, 64, &runTop), cards.at(21));
+    EXPECT_EQ(runTop, cards.at(24));
+
+    /* the next claim starts at the top of the previous run */
+    EXPECT_EQ(MM_ConcurrentCardTable::findDirtyCardRun(runTop, cards.top(), CARD_DIRTY, 64, &runTop), cards.at(30));
+    EXPECT_EQ(runTop, cards.at(31));
+
+    EXPECT_TRUE(NULL == MM_ConcurrentCardTable::findDirtyCardRun(runTop, cards.top(), CARD_DIRTY, 64, &runTop));
+    EXPECT_EQ(runTop, cards.top());
+}
+
+TEST(TestConcurrentCardTable, RunIsBounded)
+{
+    Cards cards;
+    memset(cards.at(8), CARD_DIRTY, 20);
+
+    /* by the maximum run length */
+    Card *runTop = NULL;
+    EXPECT_EQ(MM_ConcurrentCardTable::findDirtyCardRun(cards.at(0), cards.top(), CARD_DIRTY, 16, &runTop), cards.at(8));
+    EXPECT_EQ(runTop, cards.at(24));
+
+    /* by the last card to look at */
+    EXPECT_EQ(MM_ConcurrentCardTable::findDirtyCardRun(cards.at(0), cards.at(12), CARD_DIRTY, 16, &runTop), cards.at(8));
+    EXPECT_EQ(runTop, cards.at(12));
+
+    /* single cards when runs are not claimed */
+    EXPECT_EQ(MM_ConcurrentCardTable::findDirtyCardRun(cards.at(9), cards.top(), CARD_DIRTY, 1, &runTop), cards.at(9));
+    EXPECT_EQ(runTop, cards.at(10));
+}
+
+TEST(TestConcurrentCardTable, SkipsCardsOutsideMask)
+{
+    /* a card with bits outside the mask is not clean, but is not of interest either, and ends a run */
+    const Card otherBits = (Card)(CARD_DIRTY << 1);
+    Cards cards;
+    *cards.at(3) = otherBits;
+    *cards.at(40) = CARD_DIRTY;
+    *cards.at(41) = otherBits;
+    *cards.at(42) = CARD_DIRTY;
+
+    Card *runTop = NULL;
+    EXPECT_EQ(MM_ConcurrentCardTable::findDirtyCardRun(cards.at(1), cards.top(), CARD_DIRTY, 64, &runTop), cards.at(40));
+    EXPECT_EQ(runTop, cards.at(41));
+    EXPECT_EQ(MM_ConcurrentCardTable::findDirtyCardRun(runTop, cards.top(), CARD_DIRTY, 64, &runTop), cards.at(42));
+    EXPECT_EQ(runTop, cards.at(43));
+}
+
+TEST(TestConcurrentCardTable, DirtyCardAtEnd)
+{
+    /* the last card sits in a partial slot past the last complete slot */
+    Cards cards;
+    *cards.at(62) = CARD_DIRTY;
+
+    Card *runTop = NULL;
+    EXPECT_EQ(MM_ConcurrentCardTable::findDirtyCardRun(cards.at(0), cards.at(63), CARD_DIRTY, 64, &runTop), cards.at(62));
+    EXPECT_EQ(runTop, cards.at(63));
+    EXPECT_TRUE(NULL == MM_ConcurrentCardTable::findDirtyCardRun(cards.at(0), cards.at(62), CARD_DIRTY, 64, &runTop));
+    EXPECT_EQ(runTop, cards.at(62));
+}
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "PacketStack.hpp"
+
+#include <gtest/gtest.h>
+
+#include "omrthread.h"
+
+namespace {
+
+enum { pushers = 4, packetsPerPusher = 2000 };
+
+struct Pusher {
+    MM_PacketStack *stack;
+    MM_Packet *packets;
+};
+
+int J9THREAD_PROC
+pushPackets(void *arg)
+{
+    Pusher *pusher = (Pusher *)arg;
+    for (uintptr_t i = 0; i < packetsPerPusher; i++) {
+        pusher->stack->push(&pusher->packets[i]);
+    }
+    return 0;
+}
+
+}
+
+TEST(TestPacketStack, PopAllLinksPackets)
+{
+    MM_PacketStack stack;
+    MM_Packet packets[3];
+    MM_Packet *tail = NULL;
+    uintptr_t count = 0;
+
+    EXPECT_TRUE(stack.isEmpty());
+    EXPECT_TRUE(NULL == stack.popAll(&tail, &count));
+    EXPECT_TRUE(NULL == tail);
+    EXPECT_EQ(count, 0u);
+
+    for (uintptr_t i = 0; i < 3; i++) {
+        stack.push(&packets[i]);
+    }
+    EXPECT_FALSE(stack.isEmpty());
+
+    /* most recently pushed first, linked both ways */
+    MM_Packet *head = stack.popAll(&tail, &count);
+    EXPECT_TRUE(stack.isEmpty());
+    EXPECT_EQ(count, 3u);
+    EXPECT_EQ(head, &packets[2]);
+    EXPECT_EQ(tail, &packets[0]);
+    EXPECT_TRUE(NULL == head->_previous);
+    EXPECT_EQ(head->_next, &packets[1]);
+    EXPECT_EQ(packets[1]._previous, &packets[2]);
+    EXPECT_EQ(packets[1]._next, &packets[0]);
+    EXPECT_EQ(tail->_previous, &packets[1]);
+    EXPECT_TRUE(NULL == tail->_next);
+
+    /* packets pushed after a drain start a new list */
+    stack.push(&packets[1]);
+    head = stack.popAll(&tail, &count);
+    EXPECT_EQ(count, 1u);
+    EXPECT_EQ(head, &packets[1]);
+    EXPECT_EQ(tail, &packets[1]);
+    EXPECT_TRUE(NULL == head->_next);
+    EXPECT_TRUE(NULL == head->_previous);
+}
+
+TEST(TestPacketStack, ConcurrentPushesAreDrainedOnce)
+{
+    MM_PacketStack stack;
+    MM_Packet *packets = new MM_Packet[pushers * packetsPerPusher];
+    uintptr_t *seen = new uintptr_t[pushers * packetsPerPusher]();
+    Pusher pusherArgs[pushers];
+    omrthread_t threads[pushers];
+
+    for (uintptr_t i = 0; i < pushers; i++) {
+        omrthread_attr_t attr = NULL;
+        pusherArgs[i].stack = &stack;
+        pusherArgs[i].packets = &packets[i * packetsPerPusher];
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_init(&attr));
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE));
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_create_ex(&threads[i], &attr, 0, pushPackets, &pusherArgs[i]));
+        ASSERT_EQ(J9THREAD_SUCCESS, omrthread_attr_destroy(&attr));
+    }
+
+    /* drain while the pushers run, until every packet has been drained */
+    uintptr_t drained = 0;
+    while (drained < (pushers * packetsPerPusher)) {
+        MM_Packet *tail = NULL;
+        uintptr_t count = 0;
+        MM_Packet *head = stack.popAll(&tail, &count);
+        if (NULL != head) {
+            uintptr_t listed = 0;
+            for (MM_Packet *packet = head; NULL != packet; packet = packet->_next) {
+                seen[packet - packets] += 1;
+                listed += 1;
+                if (NULL == packet->_next) {
+                    EXPECT_EQ(packet, tail);
+                }
+            }
+            EXPECT_EQ(listed, count);
+            drained += count;
+        } else {
+            omrthread_yield();
+        }
+    }
+    for (uintptr_t i = 0; i < pushers; i++) {
+        EXPECT_EQ(J9THREAD_SUCCESS, omrthread_join(threads[i]));
+    }
+
+    EXPECT_TRUE(stack.isEmpty());
+    for (uintptr_t i = 0; i < (pushers * packetsPerPusher); i++) {
+        EXPECT_EQ(seen[i], 1u) << "packet " << i;
+    }
+    delete[] seen;
+    delete[] packets;
+}
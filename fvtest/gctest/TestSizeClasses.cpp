@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "SizeClasses.hpp"
+
+#include <gtest/gtest.h>
+#include <string.h>
+
+#include "gcTestHelpers.hpp"
+
+namespace {
+
+const uintptr_t defaultCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1] = SMALL_SIZECLASSES;
+const char *profileFile = "TestSizeClasses_profile.txt";
+
+struct Tuning {
+    uintptr_t samples[OMR_SIZECLASSES_SAMPLE_GRANULES + 1];
+    uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+    uint64_t currentWaste;
+    uint64_t tunedWaste;
+    uint64_t waste[OMR_SIZECLASSES_TUNING_ENTRIES];
+    uint16_t lower[OMR_SIZECLASSES_TUNING_ENTRIES];
+
+    Tuning() : currentWaste(0), tunedWaste(0)
+    {
+        memset(samples, 0, sizeof(samples));
+        memset(cellSizes, 0xff, sizeof(cellSizes));
+    }
+
+    void sample(uintptr_t sizeInBytes, uintptr_t count)
+    {
+        samples[sizeInBytes / OMR_SIZECLASSES_SAMPLE_GRANULE] += count;
+    }
+
+    uintptr_t tune()
+    {
+        return MM_SizeClasses::tuneCellSizes(samples, defaultCellSizes, cellSizes, &currentWaste, &tunedWaste, waste, lower);
+    }
+
+    bool hasCellSize(uintptr_t cellSize) const
+    {
+        for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+            if (cellSize == cellSizes[sizeClass]) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+}
+
+TEST(TestSizeClasses, TuneToSampledSizes)
+{
+    Tuning *tuning = new Tuning();
+    tuning->sample(24, 100);
+    tuning->sample(40, 50);
+    tuning->sample(1000, 10);
+
+    EXPECT_EQ(tuning->tune(), 160u);
+    /* 24 -> 32, 40 -> 64 and 1000 -> 1200 with the default classes */
+    EXPECT_EQ(tuning->currentWaste, (uint64_t)((100 * 8) + (50 * 24) + (10 * 200)));
+    EXPECT_EQ(tuning->tunedWaste, 0u);
+    EXPECT_TRUE(tuning->hasCellSize(24));
+    EXPECT_TRUE(tuning->hasCellSize(40));
+    EXPECT_TRUE(tuning->hasCellSize(1000));
+
+    EXPECT_EQ(tuning->cellSizes[0], 0u);
+    EXPECT_EQ(tuning->cellSizes[OMR_SIZECLASSES_MAX_SMALL], (uintptr_t)OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES);
+    for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+        EXPECT_EQ(tuning->cellSizes[sizeClass] % OMR_SIZECLASSES_SAMPLE_GRANULE, 0u);
+        EXPECT_GT(tuning->cellSizes[sizeClass], tuning->cellSizes[sizeClass - 1]);
+    }
+    delete tuning;
+}
+
+TEST(TestSizeClasses, SmallestClassBound)
+{
+    /* nothing is smaller than the smallest class, so 8 byte samples still lose 8 bytes each */
+    Tuning *tuning = new Tuning();
+    tuning->sample(8, 7);
+
+    EXPECT_EQ(tuning->tune(), 7u);
+    EXPECT_EQ(tuning->currentWaste, 56u);
+    EXPECT_EQ(tuning->tunedWaste, 56u);
+    EXPECT_EQ(tuning->cellSizes[OMR_SIZECLASSES_MIN_SMALL], (uintptr_t)1 << OMR_SIZECLASSES_LOG_SMALLEST);
+    delete tuning;
+}
+
+TEST(TestSizeClasses, NoSamples)
+{
+    Tuning *tuning = new Tuning();
+
+    EXPECT_EQ(tuning->tune(), 0u);
+    EXPECT_EQ(tuning->currentWaste, 0u);
+    EXPECT_EQ(tuning->cellSizes[OMR_SIZECLASSES_MIN_SMALL], (uintptr_t)-1);
+    delete tuning;
+}
+
+TEST(TestSizeClasses, ProfileRoundTrip)
+{
+    OMRPortLibrary *portLibrary = gcTestEnv->getPortLibrary();
+    Tuning *tuning = new Tuning();
+    tuning->sample(24, 100);
+    tuning->sample(512, 3);
+    uintptr_t sampleCount = tuning->tune();
+
+    ASSERT_TRUE(MM_SizeClasses::writeProfile(portLibrary, profileFile, tuning->cellSizes, sampleCount, tuning->currentWaste, tuning->tunedWaste));
+    uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+    EXPECT_EQ(MM_SizeClasses::readProfile(portLibrary, profileFile, cellSizes), MM_SizeClasses::profileLoaded);
+    EXPECT_EQ(0, memcmp(cellSizes, tuning->cellSizes, sizeof(cellSizes)));
+
+    OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+    omrfile_unlink(profileFile);
+    delete tuning;
+}
+
+TEST(TestSizeClasses, ProfileRejected)
+{
+    OMRPortLibrary *portLibrary = gcTestEnv->getPortLibrary();
+    OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+    uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+    memset(cellSizes, 0, sizeof(cellSizes));
+
+    omrfile_unlink(profileFile);
+    EXPECT_EQ(MM_SizeClasses::readProfile(portLibrary, profileFile, cellSizes), MM_SizeClasses::profileMissing);
+
+    /* the largest class must be the largest small size */
+    uintptr_t badSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+    memcpy(badSizes, defaultCellSizes, sizeof(badSizes));
+    badSizes[OMR_SIZECLASSES_MAX_SMALL] -= OMR_SIZECLASSES_SAMPLE_GRANULE;
+    ASSERT_TRUE(MM_SizeClasses::writeProfile(portLibrary, profileFile, badSizes, 1, 0, 0));
+    EXPECT_EQ(MM_SizeClasses::readProfile(portLibrary, profileFile, cellSizes), MM_SizeClasses::profileInvalid);
+
+    /* cell sizes must increase */
+    memcpy(badSizes, defaultCellSizes, sizeof(badSizes));
+    badSizes[OMR_SIZECLASSES_MIN_SMALL + 1] = badSizes[OMR_SIZECLASSES_MIN_SMALL];
+    ASSERT_TRUE(MM_SizeClasses::writeProfile(portLibrary, profileFile, badSizes, 1, 0, 0));
+    EXPECT_EQ(MM_SizeClasses::readProfile(portLibrary, profileFile, cellSizes), MM_SizeClasses::profileInvalid);
+
+    /* nothing read is applied */
+    EXPECT_EQ(cellSizes[OMR_SIZECLASSES_MAX_SMALL], 0u);
+    omrfile_unlink(profileFile);
+}
@@ -1064,6 +1064,15 @@ TEST_F(ThreadCreateTest, NumaSetAffinityBlindly)
 	omrthread_numa_set_node_affinity(omrthread_self(), nodeList, NODE_LIST_SIZE, 0);
 }
 
+TEST_F(ThreadCreateTest, GetCurrentCPU)
+{
+	intptr_t cpu = omrthread_get_current_cpu();
+	ASSERT_LE((intptr_t)-1, cpu) << "Invalid current CPU";
+#if defined(LINUX) && !defined(OMRZTPF)
+	ASSERT_LE((intptr_t)0, cpu) << "Current CPU should be known on Linux";
+#endif /* defined(LINUX) && !defined(OMRZTPF) */
+}
+
 TEST_F(ThreadCreateTest, NumaSetAffinity)
 {
 	uintptr_t status = 0;
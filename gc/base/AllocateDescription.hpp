@@ -74,6 +74,7 @@ protected:
 	bool  _collectAndClimb;
 	bool  _climb;				/* indicates that current attempt to allocate should try parent, if current subspace failed */
 	bool  _completedFromTlh;
+	uintptr_t _allocationSite; /**< language-provided token identifying the allocation site (0 if unknown), attributed by allocation sampling */
 
 public:
 
@@ -128,6 +129,9 @@ public:
 	MMINLINE void setMemorySubSpace(MM_MemorySubSpace *memorySubSpace) { _memorySubSpace = memorySubSpace; }
 
 	MMINLINE void setAllocationTaxSize(uintptr_t size)	{ _allocationTaxSize = size; }
+
+	MMINLINE uintptr_t getAllocationSite() { return _allocationSite; }
+	MMINLINE void setAllocationSite(uintptr_t allocationSite) { _allocationSite = allocationSite; }
 	MMINLINE uintptr_t getAllocationTaxSize() 			{ return _allocationTaxSize; }
 
 	/**
@@ -245,6 +249,7 @@ public:
 		, _collectAndClimb(collectAndClimb)
 		, _climb(false)
 		, _completedFromTlh(false)
+		, _allocationSite(0)
 	{}
 };
 
@@ -27,6 +27,12 @@
 #include "omrcomp.h"
 #include "modronbase.h"
 
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif /* defined(__AVX512F__) || defined(__AVX2__) */
+
 #if defined(OMR_ENV_DATA64)
 #define J9BITS_BITS_IN_SLOT 64
 #else
@@ -94,6 +100,103 @@ public:
 #endif /* !defined(OMR_ENV_DATA64) */
 	}
 
+	/**
+	 * Find the first non-zero slot in the range [current, top).
+	 * Used to skip runs of empty heap map slots.  Where the compiler targets AVX-512, AVX2 or SSE2 the
+	 * run is tested a full vector at a time, otherwise several slots are OR'd together per test.
+	 * @note Never reads beyond top.
+	 * @note The build does not pass -mavx2 or -mavx512f, so x86-64 uses the SSE2 path unless the
+	 * compiler flags are changed to target a newer processor.
+	 * @return Address of the first non-zero slot, or top if all slots in the range are zero.
+	 */
+	MMINLINE static uintptr_t *findNonZeroSlot(uintptr_t *current, uintptr_t *top)
+	{
+#if defined(__AVX512F__)
+		const uintptr_t slotsPerVector = sizeof(__m512i) / sizeof(uintptr_t);
+		while ((uintptr_t)(top - current) >= slotsPerVector) {
+			__m512i vector = _mm512_loadu_si512((const void *)current);
+			if (0 != _mm512_test_epi32_mask(vector, vector)) {
+				break;
+			}
+			current += slotsPerVector;
+		}
+#elif defined(__AVX2__)
+		const uintptr_t slotsPerVector = sizeof(__m256i) / sizeof(uintptr_t);
+		while ((uintptr_t)(top - current) >= slotsPerVector) {
+			__m256i vector = _mm256_loadu_si256((const __m256i *)current);
+			if (!_mm256_testz_si256(vector, vector)) {
+				break;
+			}
+			current += slotsPerVector;
+		}
+#elif defined(__SSE2__)
+		const uintptr_t slotsPerVector = 2 * sizeof(__m128i) / sizeof(uintptr_t);
+		const __m128i zero = _mm_setzero_si128();
+		while ((uintptr_t)(top - current) >= slotsPerVector) {
+			__m128i vector = _mm_or_si128(_mm_loadu_si128((const __m128i *)current), _mm_loadu_si128(((const __m128i *)current) + 1));
+			if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(vector, zero))) {
+				break;
+			}
+			current += slotsPerVector;
+		}
+#else /* defined(__AVX512F__) */
+		while ((uintptr_t)(top - current) >= 4) {
+			if (0 != (current[0] | current[1] | current[2] | current[3])) {
+				break;
+			}
+			current += 4;
+		}
+#endif /* defined(__AVX512F__) */
+
+		/* Locate the exact slot within the final (partial) group */
+		while ((current < top) && (0 == *current)) {
+			current += 1;
+		}
+		return current;
+	}
+
+	/**
+	 * Calculate the number of bits set to 1 in the slots in the range [current, top).
+	 * Used to count the marked objects of a heap map range.  Where the compiler targets AVX-512 VPOPCNTDQ or
+	 * AVX2 the range is counted a full vector at a time, otherwise a slot at a time.
+	 * @note Never reads beyond top.
+	 * @return Number of bits set to 1.
+	 */
+	MMINLINE static uintptr_t populationCount(const uintptr_t *current, const uintptr_t *top)
+	{
+		uintptr_t count = 0;
+
+#if defined(OMR_ENV_DATA64) && defined(__AVX512VPOPCNTDQ__)
+		const uintptr_t slotsPerVector = sizeof(__m512i) / sizeof(uintptr_t);
+		__m512i counts = _mm512_setzero_si512();
+		while ((uintptr_t)(top - current) >= slotsPerVector) {
+			counts = _mm512_add_epi64(counts, _mm512_popcnt_epi64(_mm512_loadu_si512((const void *)current)));
+			current += slotsPerVector;
+		}
+		count = (uintptr_t)_mm512_reduce_add_epi64(counts);
+#elif defined(OMR_ENV_DATA64) && defined(__AVX2__)
+		/* Look up the count of each nibble and sum the bytes of each 64 bit lane */
+		const uintptr_t slotsPerVector = sizeof(__m256i) / sizeof(uintptr_t);
+		const __m256i nibbleCounts = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+		const __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+		__m256i counts = _mm256_setzero_si256();
+		while ((uintptr_t)(top - current) >= slotsPerVector) {
+			__m256i vector = _mm256_loadu_si256((const __m256i *)current);
+			__m256i low = _mm256_shuffle_epi8(nibbleCounts, _mm256_and_si256(vector, lowNibbles));
+			__m256i high = _mm256_shuffle_epi8(nibbleCounts, _mm256_and_si256(_mm256_srli_epi16(vector, 4), lowNibbles));
+			counts = _mm256_add_epi64(counts, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+			current += slotsPerVector;
+		}
+		count = (uintptr_t)(_mm256_extract_epi64(counts, 0) + _mm256_extract_epi64(counts, 1) + _mm256_extract_epi64(counts, 2) + _mm256_extract_epi64(counts, 3));
+#endif /* defined(OMR_ENV_DATA64) && defined(__AVX512VPOPCNTDQ__) */
+
+		while (current < top) {
+			count += populationCount(*current);
+			current += 1;
+		}
+		return count;
+	}
+
 #if defined(OMR_OS_WINDOWS) && !defined(OMR_ENV_DATA64)
 	/**
 	 * Return the number of bits set to 0 before the first bit set to one starting at the lowest
@@ -47,7 +47,7 @@ MM_CardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 	
 	/* Instantiate the Virtual Memory object for the card table */
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
-	if (memoryManager->createVirtualMemoryForMetadata(env, &_cardTableMemoryHandle, extensions->heapAlignment, cardTableSizeRequired)) {
+	if (memoryManager->createVirtualMemoryForMetadata(env, &_cardTableMemoryHandle, extensions->heapAlignment, cardTableSizeRequired, extensions->cardTablePageSize, extensions->cardTablePageFlags)) {
 		_cardTableStart = (Card *)(memoryManager->getHeapBase(&_cardTableMemoryHandle));
 		/* Initialize _heapbase; we will reset _heapAlloc in heapAddRange()/heapRemoveRange() as heap changes */
 		_heapBase = (void *)heap->getHeapBase();
@@ -84,6 +84,11 @@ public:
 	 */
 	void *getHeapBase() { return _heapBase; };
 
+	/**
+	 * @return The memory handle for the card table backing store.
+	 */
+	MM_MemoryHandle *getMemoryHandle() { return &_cardTableMemoryHandle; };
+
 	/**
 	 * Checks if card is dirty or has a specific value
  	 * @param[in] env A GC thread
@@ -30,6 +30,7 @@
 
 #include "Configuration.hpp"
 
+#include "AllocationSiteStats.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -74,6 +75,10 @@ MM_Configuration::initialize(MM_EnvironmentBase* env)
 				initializeGCParameters(env);
 				extensions->_lightweightNonReentrantLockPool = pool_new(sizeof(J9ThreadMonitorTracing), 0, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_MM, POOL_FOR_PORT(env->getPortLibrary()));
 				result = (NULL != extensions->_lightweightNonReentrantLockPool);
+				if (result && (0 != extensions->allocationSamplingInterval)) {
+					extensions->allocationSiteStats = MM_AllocationSiteStats::newInstance(env, extensions->allocationSiteTopK);
+					result = (NULL != extensions->allocationSiteStats);
+				}
 			}
 		}
 	}
@@ -136,6 +141,11 @@ MM_Configuration::tearDown(MM_EnvironmentBase* env)
 		extensions->heapRegionManager = NULL;
 	}
 
+	if (NULL != extensions->allocationSiteStats) {
+		extensions->allocationSiteStats->kill(env);
+		extensions->allocationSiteStats = NULL;
+	}
+
 	if (NULL != extensions->_lightweightNonReentrantLockPool) {
 		pool_kill(extensions->_lightweightNonReentrantLockPool);
 		extensions->_lightweightNonReentrantLockPool = NULL;
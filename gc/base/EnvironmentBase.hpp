@@ -81,6 +81,7 @@ private:
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
 	uintptr_t _slaveID;
 	uintptr_t _environmentId;
+	uintptr_t _numaNode; /**< NUMA node (1-based) the GC thread works on, or 0 if it has no node affinity */
 
 protected:
 	OMR_VM *_omrVM;
@@ -147,6 +148,9 @@ public:
 	MM_FreeEntrySizeClassStats _freeEntrySizeClassStats;  /**< GC thread local statistics structure for heap free entry size (sizeClass) distribution */
 
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
+	uintptr_t _allocationSampleBytes; /**< Bytes allocated since the last allocation site sample */
+	uintptr_t _allocationSampleThreshold; /**< Randomized distance, in bytes, of the next allocation site sample (0 before the first refresh) */
+	uint32_t _allocationSampleSeed; /**< State of the xorshift generator that randomizes the sampling distance */
 
 	uintptr_t approxScanCacheCount; /**< Local copy of approximate entries in global Cache Scan List. Updated upon allocation of new cache. */
 
@@ -333,6 +337,18 @@ public:
 	 */
 	MMINLINE void setSlaveID(uintptr_t slaveID) { _slaveID = slaveID; }
 
+	/**
+	 * Get the NUMA node the thread works on, as cached by the dispatcher or collector.
+	 * @return the index of the node, where 1 is the first node (0 indicates no affinity)
+	 */
+	MMINLINE uintptr_t getNumaNode() { return _numaNode; }
+
+	/**
+	 * Set the NUMA node the thread works on.
+	 * @param numaNode the index of the node, where 1 is the first node (0 indicates no affinity)
+	 */
+	MMINLINE void setNumaNode(uintptr_t numaNode) { _numaNode = numaNode; }
+
 	/**
 	 * Enguires if this thread is the master.
 	 * return true if the thread is the master thread, false otherwise.
@@ -614,6 +630,7 @@ public:
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
 		,_slaveID(0)
 		,_environmentId(0)
+		,_numaNode(0)
 		,_omrVM(omrVMThread->_vm)
 		,_omrVMThread(omrVMThread)
 		,_portLibrary(omrVMThread->_vm->_runtime->_portLibrary)
@@ -646,6 +663,9 @@ public:
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
+		,_allocationSampleBytes(0)
+		,_allocationSampleThreshold(0)
+		,_allocationSampleSeed(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
@@ -667,6 +687,7 @@ public:
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
 		,_slaveID(0)
 		,_environmentId(0)
+		,_numaNode(0)
 		,_omrVM(omrVM)
 		,_omrVMThread(NULL)
 		,_portLibrary(omrVM->_runtime->_portLibrary)
@@ -698,6 +719,9 @@ public:
 		,_slaveThreadCpuTimeNanos(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
+		,_allocationSampleBytes(0)
+		,_allocationSampleThreshold(0)
+		,_allocationSampleSeed(0)
 		,approxScanCacheCount(0)
 		,_activeValidator(NULL)
 		,_lastSyncPointReached(NULL)
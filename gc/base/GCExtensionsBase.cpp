@@ -218,6 +218,13 @@ MM_GCExtensionsBase::validateDefaultPageParameters(uintptr_t pageSize, uintptr_t
 	return result;
 }
 
+bool
+MM_GCExtensionsBase::isPageSizeSupported(MM_EnvironmentBase* env, uintptr_t pageSize, uintptr_t pageFlags)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	return validateDefaultPageParameters(pageSize, pageFlags, omrvmem_supported_page_sizes(), omrvmem_supported_page_flags());
+}
+
 void
 MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 {
@@ -232,6 +239,14 @@ MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 	}
 #endif /* defined(OMR_GC_REALTIME) */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (NULL != sizeClassProfile) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		omrmem_free_memory(sizeClassProfile);
+		sizeClassProfile = NULL;
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+
 	objectModel.tearDown(this);
 	mixedObjectModel.tearDown(this);
 	indexableObjectModel.tearDown(this);
@@ -47,6 +47,7 @@
 #include "ScavengerStats.hpp"
 #include "SublistPool.hpp"
 
+class MM_AllocationSiteStats;
 class MM_CardTable;
 class MM_ClassLoaderRememberedSet;
 class MM_CollectorLanguageInterface;
@@ -103,6 +104,9 @@ class HeapRegionStateTable;
 #define DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE 512
 #define DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE 16384
 
+/* Upper bound on the marking prefetch depth (the size of the on-stack scan pipeline). */
+#define MARKING_PREFETCH_DEPTH_MAX 16
+
 #define DEFAULT_SCAN_CACHE_MAXIMUM_SIZE (128 * 1024)
 #define DEFAULT_SCAN_CACHE_MINIMUM_SIZE (8 * 1024)
 
@@ -261,6 +265,11 @@ public:
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	uintptr_t heapMapPageSize; /**< page size for heap maps (e.g. the mark map), 0 to use gcmetadataPageSize */
+	uintptr_t heapMapPageFlags; /**< page flags for heap maps, used only if heapMapPageSize is set */
+	uintptr_t cardTablePageSize; /**< page size for the card table, 0 to use gcmetadataPageSize */
+	uintptr_t cardTablePageFlags; /**< page flags for the card table, used only if cardTablePageSize is set */
+	bool heapPreTouch; /**< if true, committed heap memory is touched by the GC threads at startup and on expansion rather than faulted in by the first allocating thread */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
@@ -320,8 +329,12 @@ public:
 	uintptr_t tlhMaximumSize;
 	uintptr_t tlhInitialSize;
 	uintptr_t tlhIncrementSize;
+	uintptr_t tlhRefreshBatchCount; /**< number of TLHs carved out of a memory pool per (locked) fresh refresh; the extras are cached on the thread's abandoned TLH list and later refreshes take them without touching the pool (1 disables batching) */
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	uintptr_t allocationSamplingInterval; /**< if non-zero, mean number of bytes a thread allocates between allocation site samples taken at TLH refresh (each distance is randomized) */
+	uint32_t allocationSiteTopK; /**< number of most allocating sites tracked in allocationSiteStats and reported by verbose GC */
+	MM_AllocationSiteStats *allocationSiteStats; /**< top-K table of sampled allocation sites, created when allocationSamplingInterval is set */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -377,9 +390,15 @@ public:
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workStealingMark; /**< if true, parallel mark threads keep released output packets on per-thread work-stealing deques instead of the shared packet lists */
+	uintptr_t workStealingDequeSize; /**< capacity (in packets, rounded up to a power of two) of each per-thread work-stealing deque */
+	bool adaptiveGCThreading; /**< if true, the dispatcher sizes each task's thread count to the parallelism measured on previous runs of the same kind of task */
+	float adaptiveGCThreadingSampleWeight; /**< weight of the newest parallelism sample in the running average kept per kind of task */
+	float adaptiveGCThreadingHeadroom; /**< factor applied to the measured parallelism when sizing a task, so that a fully busy task is given more threads next time */
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
+	uintptr_t markingPrefetchDepth; /**< number of popped objects held in the marking scan pipeline so their headers are prefetched ahead of scanning (0 scans each object as soon as it is popped) */
 
 	bool rootScannerStatsEnabled; /**< Enable/disable recording of performance statistics for the root scanner.  Defaults to false. */
 	bool rootScannerStatsUsed; /**< Flag that indicates if rootScannerStats are used for in the last increment (by any thread, for any of its roots) */
@@ -393,6 +412,7 @@ public:
 	bool fvtest_forceScavengerBackout;
 	uintptr_t fvtest_backoutCounter;
 	bool fvtest_forcePoisonEvacuate; /**< if true poison Evacuate space with pattern at the end of scavenge */
+	bool fvtest_forceRememberedSetOverflow; /**< if true the remembered set overflows as soon as an object is remembered */
 	bool fvtest_forceNurseryResize;
 	uintptr_t fvtest_nurseryResizeCounter;
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -429,19 +449,24 @@ public:
 
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 	uintptr_t batchClearTLH;
+	bool scavengerPreZeroAllocateSpace; /**< if true (and batchClearTLH is set), the free memory of the allocate space is zeroed by the GC threads at the end of each scavenge, so TLH refreshes from it need not clear */
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 	omrthread_monitor_t gcStatsMutex;
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	uintptr_t gcThreadParkSpinCount; /**< number of spin iterations an idle or synchronizing GC thread makes before parking on a monitor (0 parks immediately) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
 		OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST = 0,
 		OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL,
+		OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST,
 	};
 	ScavengerScanOrdering scavengerScanOrdering; /**< scan ordering in Scavenger */
 #if defined(OMR_GC_MODRON_SCAVENGER)
+	uintptr_t scavengerDynamicBreadthFirstScanDepth; /**< maximum depth to which hot children are copied next to their parent with dynamic breadth first scan ordering */
+	uintptr_t scavengerDynamicBreadthFirstHotSlots; /**< number of leading reference slots of a copied object that are treated as hot with dynamic breadth first scan ordering */
 	uintptr_t scvTenureRatioHigh;
 	uintptr_t scvTenureRatioLow;
 	uintptr_t scvTenureFixedTenureAge; /**< The tenure age to use for the Fixed scavenger tenure strategy. */
@@ -451,6 +476,9 @@ public:
 	bool scvTenureStrategyAdaptive; /**< Flag for enabling the Adaptive scavenger tenure strategy. */
 	bool scvTenureStrategyLookback; /**< Flag for enabling the Lookback scavenger tenure strategy. */
 	bool scvTenureStrategyHistory; /**< Flag for enabling the History scavenger tenure strategy. */
+	bool scavengerSurvivalCensus; /**< if true, copying threads record the bytes surviving each scavenge by object age and size class */
+	uintptr_t scavengerPauseTarget; /**< target scavenge pause time in milliseconds, zero (default) leaves nursery sizing to dynamicNewSpaceSizing */
+	double scavengerOverheadBudget; /**< fraction of time the pause target controller allows scavenges to take once the pause target is met */
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -525,6 +553,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool compactIncremental; /**< if true, a compaction evacuates only a window of the most fragmented sub areas and fixes up the rest of the heap in place */
+	uintptr_t compactIncrementalWindowPercentage; /**< upper bound, as a percentage of all sub areas, on the size of an incremental compaction window */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -619,6 +649,9 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	bool segregatedAllocationContextPerCPU; /**< if true, threads refill from the allocation context and split available lists of the CPU they are running on, rather than those picked at attach */
+	uintptr_t sizeClassSamplingInterval; /**< if non-zero, the size of one in this many small allocations (per thread) is sampled for size class tuning */
+	char *sizeClassProfile; /**< if set, file the size classes are loaded from at startup (if it exists) and, when sampling, the tuned size classes are written to at shutdown. Allocated with the port library, freed at tear down */
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -644,6 +677,7 @@ public:
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
 	bool nonDeterministicSweep;
+	bool lazySweepSegregated; /**< Leave small regions unswept at the end of a segregated collection; they are swept on allocation demand instead */
 /* OMR_GC_REALTIME (in for all) */
 
 	MM_ConfigurationOptions configurationOptions; /**< holds the options struct, used during startup for selecting a Configuration */
@@ -655,6 +689,7 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool binaryLogging; /**< Enabled by -Xgc:binaryLogging.  Write verbose:gc to a file as fixed-size binary event records flushed by a background thread */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -688,6 +723,7 @@ public:
 	uintptr_t regionSize; /**< The size, in bytes, of a fixed-size table-backed region of the heap (does not apply to AUX regions) */
 	MM_NUMAManager _numaManager; /**< The object which abstracts the details of our NUMA support so that the GCExtensions and the callers don't need to duplicate the support to interpret our intention */
 	bool numaForced; /**< if true, specifies if numa is disabled or enabled (actual value stored in NUMA Manager) by command line option */
+	bool numaAwareGencon; /**< if true, gencon GC threads are distributed over the NUMA affinity leaders and the scavenger prefers copy and scan caches on the copying thread's node */
 
 	bool padToPageSize;
 	
@@ -840,6 +876,15 @@ public:
 	MMINLINE OMR_VM* getOmrVM() { return _omrVM; }
 	MMINLINE void setOmrVM(OMR_VM* omrVM) { _omrVM = omrVM; }
 
+	/**
+	 * Check if memory can be reserved with the given page size and page flags
+	 * @param[in] env the current thread
+	 * @param[in] pageSize page size to check
+	 * @param[in] pageFlags page flags to check
+	 * @return true if the pair is supported by the Port Library
+	 */
+	bool isPageSizeSupported(MM_EnvironmentBase* env, uintptr_t pageSize, uintptr_t pageFlags);
+
 	/**
 	 * Gets a pointer to the memory forge
 	 * @return Pointer to the memory forge
@@ -896,6 +941,18 @@ public:
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 	}
 	
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Concurrent Scavenger cycles are not pauses, so they stay with dynamic new space sizing.
+	 * @return true if the nursery size and the adaptive tenure age are driven by scavengerPauseTarget
+	 */
+	MMINLINE bool
+	isScavengerPauseTargetEnabled()
+	{
+		return (0 != scavengerPauseTarget) && !isConcurrentScavengerEnabled();
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 	MMINLINE bool
 	isConcurrentScavengerHWSupported()
 	{
@@ -1043,6 +1100,25 @@ public:
 
 	MMINLINE uintptr_t getMinimumFreeEntrySize() { return tlhMinimumSize; }
 
+	/**
+	 * @return the largest chunk a memory pool hands out for one mutator TLH refresh (a batched refresh takes several TLHs at once)
+	 */
+	MMINLINE uintptr_t getTLHMaximumRefreshSize() { return tlhMaximumSize * tlhRefreshBatchCount; }
+
+	/**
+	 * A memory pool hands out TLHs both for mutator refreshes and, when it can be used by the scavenger, for copy caches.
+	 * @return the largest TLH a memory pool hands out, used to size its large object allocate stats
+	 */
+	MMINLINE uintptr_t
+	getMemoryPoolTLHMaximumSize()
+	{
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		return OMR_MAX(getTLHMaximumRefreshSize(), scavengerScanCacheMaximumSize);
+#else /* OMR_GC_MODRON_SCAVENGER */
+		return getTLHMaximumRefreshSize();
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	}
+
 	MMINLINE MM_Heap* getHeap() { return heap; }
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -1358,6 +1434,11 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, heapMapPageSize(0)
+		, heapMapPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, cardTablePageSize(0)
+		, cardTablePageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, heapPreTouch(false)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
@@ -1402,8 +1483,12 @@ public:
 		, tlhMaximumSize(131072)
 		, tlhInitialSize(2048)
 		, tlhIncrementSize(4096)
+		, tlhRefreshBatchCount(1)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, allocationSamplingInterval(0)
+		, allocationSiteTopK(10)
+		, allocationSiteStats(NULL)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1445,8 +1530,14 @@ public:
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
 		, cacheListSplit(0)
+		, workStealingMark(false)
+		, workStealingDequeSize(32)
+		, adaptiveGCThreading(false)
+		, adaptiveGCThreadingSampleWeight((float)0.5)
+		, adaptiveGCThreadingHeadroom((float)1.25)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, markingPrefetchDepth(0)
 		, rootScannerStatsEnabled(false)
 		, rootScannerStatsUsed(false)
 		, fvtest_forceOldResize(0)
@@ -1457,6 +1548,7 @@ public:
 		, fvtest_forceScavengerBackout(0)
 		, fvtest_backoutCounter(0)
 		, fvtest_forcePoisonEvacuate(0)
+		, fvtest_forceRememberedSetOverflow(0)
 		, fvtest_forceNurseryResize(0)
 		, fvtest_nurseryResizeCounter(0)
 #endif /* OMR_GC_MODRON_SCAVENGER */
@@ -1488,13 +1580,17 @@ public:
 		, softMx(0) /* softMx only set if specified */
 #if defined(OMR_GC_BATCH_CLEAR_TLH)
 		, batchClearTLH(0)
+		, scavengerPreZeroAllocateSpace(false)
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
+		, gcThreadParkSpinCount(0)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 #endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_VLHGC */
 #if defined(OMR_GC_MODRON_SCAVENGER)
+		, scavengerDynamicBreadthFirstScanDepth(2)
+		, scavengerDynamicBreadthFirstHotSlots(2)
 		, scvTenureRatioHigh(OMR_SCV_TENURE_RATIO_HIGH)
 		, scvTenureRatioLow(OMR_SCV_TENURE_RATIO_LOW)
 		, scvTenureFixedTenureAge(OBJECT_HEADER_AGE_MAX)
@@ -1504,6 +1600,9 @@ public:
 		, scvTenureStrategyAdaptive(true)
 		, scvTenureStrategyLookback(true)
 		, scvTenureStrategyHistory(true)
+		, scavengerSurvivalCensus(false)
+		, scavengerPauseTarget(0)
+		, scavengerOverheadBudget(0.05)
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -1566,6 +1665,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactIncremental(false)
+		, compactIncrementalWindowPercentage(25)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1637,6 +1738,9 @@ public:
 #endif /* defined(OMR_GC_REALTIME) || defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, segregatedAllocationContextPerCPU(false)
+		, sizeClassSamplingInterval(0)
+		, sizeClassProfile(NULL)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
 		, heapRegionStateTable(NULL)
@@ -1658,12 +1762,14 @@ public:
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
 		, nonDeterministicSweep(false)
+		, lazySweepSegregated(false)
 		, configuration(NULL)
 		, verboseGCManager(NULL)
 		, verbosegcCycleTime(1000)  /* by default metronome outputs verbosegc every 1sec */
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, binaryLogging(false)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
@@ -1682,6 +1788,7 @@ public:
 		, regionSize(0)
 		, _numaManager()
 		, numaForced(false)
+		, numaAwareGencon(false)
 		, padToPageSize(false)
 		, fvtest_disableExplictMasterThread(false)
 #if defined(OMR_GC_VLHGC)
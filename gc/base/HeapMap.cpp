@@ -58,7 +58,7 @@ MM_HeapMap::initialize(MM_EnvironmentBase *env)
 	uintptr_t heapMapSizeRequired = getMaximumHeapMapSize(env);
 	
 	MM_MemoryManager *memoryManager = _extensions->memoryManager;
-	if (memoryManager->createVirtualMemoryForMetadata(env, &_heapMapMemoryHandle, _extensions->heapAlignment, heapMapSizeRequired)) {
+	if (memoryManager->createVirtualMemoryForMetadata(env, &_heapMapMemoryHandle, _extensions->heapAlignment, heapMapSizeRequired, _extensions->heapMapPageSize, _extensions->heapMapPageFlags)) {
 		_heapMapBits = (uintptr_t *)memoryManager->getHeapBase(&_heapMapMemoryHandle);
 		_heapBase = _extensions->heap->getHeapBase();
 		_heapMapBaseDelta = (uintptr_t)_heapBase;
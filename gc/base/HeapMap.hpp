@@ -129,6 +129,8 @@ public:
 
 	MMINLINE uintptr_t *getHeapMapBits() { return _heapMapBits; }
 
+	MMINLINE MM_MemoryHandle *getMemoryHandle() { return &_heapMapMemoryHandle; }
+
 	MMINLINE uintptr_t getObjectGrain() { return ((uintptr_t)1) << _heapMapBitShift; };
 		
 	MMINLINE void
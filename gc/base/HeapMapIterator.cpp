@@ -131,6 +131,17 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* Sparse liveness leaves long runs of empty map slots - skip them in bulk rather than one per iteration */
+				uintptr_t heapSlotsPerMapSlot = J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * J9BITS_BITS_IN_SLOT;
+				uintptr_t mapSlotsRemaining = MM_Math::roundToCeiling(heapSlotsPerMapSlot, (uintptr_t)(_heapChunkTop - _heapSlotCurrent)) / heapSlotsPerMapSlot;
+				uintptr_t *heapMapSlotNonEmpty = MM_Bits::findNonZeroSlot(_heapMapSlotCurrent + 1, _heapMapSlotCurrent + mapSlotsRemaining);
+				_heapSlotCurrent += heapSlotsPerMapSlot * (uintptr_t)(heapMapSlotNonEmpty - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = heapMapSlotNonEmpty;
+				if(_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
@@ -32,6 +32,7 @@
 #include "Math.hpp"
 #include "MemoryManager.hpp"
 #include "MemorySubSpace.hpp"
+#include "ParallelHeapPreTouchTask.hpp"
 #include "PhysicalArena.hpp"
 
 #if defined(OMR_VALGRIND_MEMCHECK)
@@ -358,6 +359,8 @@ MM_HeapVirtualMemory::heapAddRange(MM_EnvironmentBase* env, MM_MemorySubSpace* s
 	
 	env->getExtensions()->identityHashDataAddRange(env, subspace, size, lowAddress, highAddress);
 
+	MM_ParallelHeapPreTouchTask::preTouch(env, lowAddress, highAddress);
+
 #if defined(OMR_VALGRIND_MEMCHECK)
 	valgrindMakeMemNoaccess((uintptr_t)lowAddress,size);
 #endif /* defined(OMR_VALGRIND_MEMCHECK) */
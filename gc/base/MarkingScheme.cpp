@@ -321,15 +321,55 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
+	uintptr_t prefetchDepth = OMR_MIN(_extensions->markingPrefetchDepth, MARKING_PREFETCH_DEPTH_MAX);
+
 	do {
 		omrobjectptr_t objectPtr = NULL;
 		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
-			env->_markStats._bytesScanned += scanObject(env, objectPtr);
-			env->_markStats._objectsScanned += 1;
+			if (0 != prefetchDepth) {
+				scanObjectsPipelined(env, objectPtr, prefetchDepth);
+			} else {
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+			}
 		}
 	} while (_workPackets->handleWorkPacketOverflow(env));
 }
 
+void
+MM_MarkingScheme::scanObjectsPipelined(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t prefetchDepth)
+{
+	omrobjectptr_t pipeline[MARKING_PREFETCH_DEPTH_MAX];
+	uintptr_t head = 0;
+	uintptr_t count = 1;
+
+	prefetchObject(objectPtr);
+	pipeline[0] = objectPtr;
+
+	while (0 != count) {
+		/* Top up the pipeline, but never block for work while it still holds objects: a thread waiting in
+		 * pop() counts towards termination, so anything left in the pipeline would never be scanned.
+		 */
+		while (count < prefetchDepth) {
+			omrobjectptr_t nextPtr = (omrobjectptr_t)env->_workStack.popNoWait(env);
+			if (NULL == nextPtr) {
+				break;
+			}
+			prefetchObject(nextPtr);
+			pipeline[(head + count) % prefetchDepth] = nextPtr;
+			count += 1;
+		}
+
+		omrobjectptr_t scanPtr = pipeline[head];
+		head = (head + 1) % prefetchDepth;
+		count -= 1;
+
+		env->_markStats._bytesScanned += scanObject(env, scanPtr);
+		env->_markStats._objectsScanned += 1;
+		env->_markStats._objectsPipelined += 1;
+	}
+}
+
 /****************************************
  * Marking Core Functionality
  ****************************************/
@@ -38,6 +38,16 @@
 #include "ObjectScannerState.hpp"
 #include "WorkStack.hpp"
 
+#if defined(OMR_OS_WINDOWS) && defined(OMR_ARCH_X86)
+#include <xmmintrin.h>
+#endif /* defined(OMR_OS_WINDOWS) && defined(OMR_ARCH_X86) */
+
+/**
+ * Distance, in bytes, from the object header of the second prefetch issued for an object entering the
+ * scan pipeline, so that the first slots are also in cache when they do not share the header line.
+ */
+#define MARKING_PREFETCH_SLOTS_OFFSET 64
+
 /**
  * @todo Provide class documentation
  */
@@ -76,6 +86,30 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Private internal. Called exclusively from scanObjectsPipelined();
+	 * Prefetch the header and first slots of an object entering the scan pipeline.
+	 */
+	MMINLINE void
+	prefetchObject(omrobjectptr_t objectPtr)
+	{
+#if defined(__GNUC__)
+		__builtin_prefetch((const void *)objectPtr, 0, 3);
+		__builtin_prefetch((const void *)((uintptr_t)objectPtr + MARKING_PREFETCH_SLOTS_OFFSET), 0, 3);
+#elif defined(OMR_OS_WINDOWS) && defined(OMR_ARCH_X86)
+		_mm_prefetch((const char *)objectPtr, _MM_HINT_T0);
+		_mm_prefetch((const char *)objectPtr + MARKING_PREFETCH_SLOTS_OFFSET, _MM_HINT_T0);
+#endif /* defined(__GNUC__) */
+	}
+
+	/**
+	 * Private internal. Called exclusively from completeScan();
+	 * Scan objectPtr and whatever else can be popped without waiting, keeping up to prefetchDepth popped
+	 * objects in a FIFO so that each object's header is prefetched prefetchDepth scans before it is scanned.
+	 * Returns with the pipeline drained, so no popped object is left unscanned when the thread goes on to wait for work.
+	 */
+	void scanObjectsPipelined(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t prefetchDepth);
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
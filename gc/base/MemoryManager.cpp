@@ -394,15 +394,30 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 
 bool
 MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t alignment, uintptr_t size)
+{
+	MM_GCExtensionsBase* extensions = env->getExtensions();
+	return createVirtualMemoryForMetadata(env, handle, alignment, size, extensions->gcmetadataPageSize, extensions->gcmetadataPageFlags);
+}
+
+bool
+MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t alignment, uintptr_t size, uintptr_t pageSize, uintptr_t pageFlags)
 {
 	Assert_MM_true(NULL != handle);
 	Assert_MM_true(NULL == handle->getVirtualMemory());
 	MM_GCExtensionsBase* extensions = env->getExtensions();
 
+	/* Fall back to the GC metadata pages if no specific page size is requested or the request can not be satisfied */
+	if ((0 == pageSize) || !extensions->isPageSizeSupported(env, pageSize, pageFlags)) {
+		pageSize = extensions->gcmetadataPageSize;
+		pageFlags = extensions->gcmetadataPageFlags;
+	}
+	/* Preallocated memory is backed by GC metadata pages, so it can only be shared by consumers of the same pages */
+	bool isGCMetadataPage = (pageSize == extensions->gcmetadataPageSize) && (pageFlags == extensions->gcmetadataPageFlags);
+
 	/*
 	 * Can we take already preallocated memory?
 	 */
-	if (NULL != _preAllocated.getVirtualMemory()) {
+	if (isGCMetadataPage && (NULL != _preAllocated.getVirtualMemory())) {
 		/* base might be not aligned */
 		void* base = (void*)MM_Math::roundToCeiling(alignment, (uintptr_t)_preAllocated.getMemoryBase());
 		void* top = (void*)((uintptr_t)base + MM_Math::roundToCeiling(alignment, size));
@@ -446,8 +461,6 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 			uintptr_t mode = (OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE);
 			uintptr_t options = 0;
 
-			uintptr_t pageSize = extensions->gcmetadataPageSize;
-			uintptr_t pageFlags = extensions->gcmetadataPageFlags;
 			Assert_MM_true(0 != pageSize);
 
 			/*
@@ -470,7 +483,7 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 				 * Reminder can be used as a preallocated memory
 				 */
 				allocateSize = MM_Math::roundToCeiling(minimumAllocationUnit, allocateSize);
-				isOverAllocationRequested = true;
+				isOverAllocationRequested = isGCMetadataPage;
 			}
 
 			/*
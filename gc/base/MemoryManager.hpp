@@ -160,6 +160,20 @@ public:
 	 */
 	bool createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t heapAlignment, uintptr_t size);
 
+	/**
+	 * Creates the correct type of VirtualMemory object for the current platform and configuration,
+	 * backed by pages of the specified size rather than the default GC metadata page size
+	 *
+	 * @param env environment
+	 * @param[in/out] handle pointer to memory handle
+	 * @param heapAlignment required heap alignment
+	 * @param size required memory size
+	 * @param pageSize requested page size, 0 to use the default GC metadata page size
+	 * @param pageFlags requested page flags
+	 * @return true if pointer to virtual memory is not NULL
+	 */
+	bool createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t heapAlignment, uintptr_t size, uintptr_t pageSize, uintptr_t pageFlags);
+
 	/**
 	 * Destroy virtual memory instance
 	 *
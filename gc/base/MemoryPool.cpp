@@ -187,6 +187,45 @@ MM_MemoryPool::reset(Cause cause)
 	_darkMatterSamples = 0;
 }	
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+/**
+ * Count of all GCs (global and scavenge) started so far.
+ */
+static MMINLINE uintptr_t
+getPreZeroedGCCount(MM_GCExtensionsBase *extensions)
+{
+	return extensions->globalGCStats.gcCount + extensions->scavengerStats._gcCount;
+}
+
+void
+MM_MemoryPool::setPreZeroedRange(MM_EnvironmentBase *env, void *base, void *top)
+{
+	_preZeroedBase = (uintptr_t)base;
+	_preZeroedTop = (uintptr_t)top;
+	_preZeroedGCCount = getPreZeroedGCCount(_extensions);
+}
+
+bool
+MM_MemoryPool::claimPreZeroedRange(MM_EnvironmentBase *env, void *base, void *top)
+{
+	if (getPreZeroedGCCount(_extensions) != _preZeroedGCCount) {
+		return false;
+	}
+
+	/* Advance the handed out mark past the range whether or not it is claimed, as the range is about to be written */
+	uintptr_t preZeroedBase = _preZeroedBase;
+	while (preZeroedBase < (uintptr_t)top) {
+		uintptr_t oldBase = MM_AtomicOperations::lockCompareExchange(&_preZeroedBase, preZeroedBase, (uintptr_t)top);
+		if (oldBase == preZeroedBase) {
+			return ((uintptr_t)base >= preZeroedBase) && ((uintptr_t)top <= _preZeroedTop);
+		}
+		preZeroedBase = oldBase;
+	}
+
+	return false;
+}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+
 MM_HeapLinkedFreeHeader *
 MM_MemoryPool::rebuildFreeListInRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapLinkedFreeHeader *previousFreeEntry)
 {
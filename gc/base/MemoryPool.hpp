@@ -102,6 +102,11 @@ protected:
 
 	uintptr_t _darkMatterBytes; /**< estimate of the dark matter in this pool (in bytes) */
 	uintptr_t _darkMatterSamples;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	volatile uintptr_t _preZeroedBase; /**< lowest address of the pre-zeroed range which has not yet been handed out in a TLH */
+	uintptr_t _preZeroedTop; /**< top of the range of free memory zeroed at the end of the last scavenge */
+	uintptr_t _preZeroedGCCount; /**< GC count when the range was zeroed - any later GC invalidates it */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	/*
 	 * Function members 
 	 */
@@ -261,6 +266,26 @@ public:
 	};
 
 	virtual void reset(Cause cause = any);
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Record that the free memory of the receiver in [base, top) has been zeroed, apart from the free entry headers.
+	 * The record is valid until the next GC.
+	 * @param base[in] the lowest free entry zeroed
+	 * @param top[in] the top of the highest free entry zeroed
+	 */
+	void setPreZeroedRange(MM_EnvironmentBase *env, void *base, void *top);
+
+	/**
+	 * Note that [base, top) has been handed out as a TLH, and determine whether it is still zeroed.
+	 * Ranges are handed out from the head of an address ordered free list, so a range entirely above everything
+	 * handed out since the free memory was zeroed has not been written, except for the free entry header at its base.
+	 * @param base[in] the base of the TLH
+	 * @param top[in] the top of the TLH
+	 * @return true if the range needs only its free entry header cleared
+	 */
+	bool claimPreZeroedRange(MM_EnvironmentBase *env, void *base, void *top);
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	virtual MM_HeapLinkedFreeHeader *rebuildFreeListInRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptor *region, MM_HeapLinkedFreeHeader *previousFreeEntry);
 	virtual void acquireResetLock(MM_EnvironmentBase *env) {};
 	virtual void releaseResetLock(MM_EnvironmentBase *env) {};
@@ -387,6 +412,11 @@ public:
 		_largeObjectAllocateStats(NULL),
 		_darkMatterBytes(0)
 		, _darkMatterSamples(0)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		, _preZeroedBase(0)
+		, _preZeroedTop(0)
+		, _preZeroedGCCount(UDATA_MAX)
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -419,6 +449,11 @@ public:
 		_largeObjectAllocateStats(NULL),
 		_darkMatterBytes(0)
 		, _darkMatterSamples(0)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		, _preZeroedBase(0)
+		, _preZeroedTop(0)
+		, _preZeroedGCCount(UDATA_MAX)
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -435,8 +435,7 @@ MM_MemorySubSpaceSemiSpace::initialize(MM_EnvironmentBase *env)
 
 	_memorySubSpaceSurvivor->isAllocatable(false);
 
-	/* this memoryPool can be used by scavenger, maximum tlh size should be max(_extensions->tlhMaximumSize, _extensions->scavengerScanCacheMaximumSize) */
-	uintptr_t tlhMaximumSize = OMR_MAX(_extensions->tlhMaximumSize, _extensions->scavengerScanCacheMaximumSize);
+	uintptr_t tlhMaximumSize = _extensions->getMemoryPoolTLHMaximumSize();
 	_largeObjectAllocateStats = MM_LargeObjectAllocateStats::newInstance(env, (uint16_t)_extensions->largeObjectAllocationProfilingTopK, _extensions->largeObjectAllocationProfilingThreshold, _extensions->largeObjectAllocationProfilingVeryLargeObjectThreshold, (float)_extensions->largeObjectAllocationProfilingSizeClassRatio / (float)100.0,
 			_extensions->heap->getMaximumMemorySize(), tlhMaximumSize + _extensions->minimumFreeEntrySize, _extensions->tlhMinimumSize);
 	if (NULL == _largeObjectAllocateStats) {
@@ -1006,6 +1005,137 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 	}
 }
 
+/**
+ * Answer the fraction of the objects one scavenge younger than the tenure age that survived to the tenure age.
+ * @param tenureAge the adaptive tenure age
+ * @return the survival rate, or -1.0 if there is no flip history to measure it
+ */
+double
+MM_MemorySubSpaceSemiSpace::getTenureCohortSurvivalRate(MM_EnvironmentBase *env, uintptr_t tenureAge)
+{
+	MM_ScavengerStats *stats = &_extensions->scavengerStats;
+	double survivalRate = -1.0;
+
+	/* Flip history is indexed by age before the copy plus one; index 0 of the previous scavenge holds the bytes allocated since then */
+	uintptr_t previousBytes = stats->getFlipHistory(1)->_flipBytes[tenureAge - 1];
+	if (0 != previousBytes) {
+		uintptr_t currentBytes = stats->getFlipHistory(0)->_flipBytes[tenureAge] + stats->getFlipHistory(0)->_tenureBytes[tenureAge];
+		survivalRate = (double)currentBytes / (double)previousBytes;
+	}
+
+	return survivalRate;
+}
+
+/**
+ * Adjust the nursery size, survivor tilt and adaptive tenure age to meet the scavenge pause target and overhead budget.
+ * Replaces dynamic new space sizing when scavengerPauseTarget is set. The pause target is served first: an over-long
+ * average pause contracts the nursery in proportion to the overshoot and tenures a strongly surviving cohort sooner.
+ * Once the pause target is met, an average scavenge time ratio above the overhead budget expands the nursery as far as the
+ * pause target allows. With both met and pauses below half the target, a cohort still dying at the tenure age is kept
+ * in the nursery for another scavenge. The scavenger skips its own adaptive tenure age step while the pause target is set.
+ */
+void
+MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectPauseTarget(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	MM_ScavengerStats *scavengerStats = &extensions->scavengerStats;
+	uintptr_t regionSize = extensions->getHeap()->getHeapRegionManager()->getRegionSize();
+	bool debug = extensions->debugDynamicNewSpaceSizing;
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+
+	if(debug) {
+		omrtty_printf("Pause target check:\n");
+	}
+
+	/* Without a previous scavenge or with the wall clock shifted backwards there is no usable interval */
+	bool measurable = (1 < scavengerStats->_gcCount)
+			&& (scavengerStats->_startTime >= _lastScavengeEndTime)
+			&& (scavengerStats->_endTime >= scavengerStats->_startTime);
+	uint64_t pauseTime = omrtime_hires_delta(scavengerStats->_startTime, scavengerStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uint64_t intervalTime = omrtime_hires_delta(_lastScavengeEndTime, scavengerStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	_lastScavengeEndTime = scavengerStats->_endTime;
+
+	if (!measurable || (0 == intervalTime)) {
+		if(debug) {
+			omrtty_printf("\tNo usable scavenge interval - ABORTING\n");
+		}
+	} else {
+		double targetPauseTime = (double)extensions->scavengerPauseTarget * 1000.0;
+		double timeRatio = (double)((int64_t)pauseTime) / (double)((int64_t)intervalTime);
+
+		/* Averages follow longer pauses and higher ratios quickly, and shorter pauses and lower ratios slowly */
+		if (0.0 == _averageScavengePauseTime) {
+			_averageScavengePauseTime = (double)((int64_t)pauseTime);
+			_averageScavengeTimeRatio = timeRatio;
+		} else {
+			double pauseWeight = ((double)((int64_t)pauseTime) > _averageScavengePauseTime) ? 0.5 : 0.2;
+			double ratioWeight = (timeRatio > _averageScavengeTimeRatio) ? 0.5 : 0.2;
+			_averageScavengePauseTime = ((double)((int64_t)pauseTime) * pauseWeight) + (_averageScavengePauseTime * (1.0 - pauseWeight));
+			_averageScavengeTimeRatio = (timeRatio * ratioWeight) + (_averageScavengeTimeRatio * (1.0 - ratioWeight));
+		}
+
+		uintptr_t currentSize = getCurrentSize();
+		uintptr_t tenureAge = extensions->scvTenureAdaptiveTenureAge;
+		double survivalRate = getTenureCohortSurvivalRate(env, tenureAge);
+
+		if(debug) {
+			omrtty_printf("\tPause us:%llu average:%lf target:%lf\n", pauseTime, _averageScavengePauseTime, targetPauseTime);
+			omrtty_printf("\tTime ratio:%lf average:%lf budget:%lf\n", timeRatio, _averageScavengeTimeRatio, extensions->scavengerOverheadBudget);
+			omrtty_printf("\tTenure age:%zu cohort survival rate:%lf\n", tenureAge, survivalRate);
+		}
+
+		if (_averageScavengePauseTime > targetPauseTime) {
+			/* Fewer objects are live in a smaller nursery when it fills up */
+			double contractionFactor = OMR_MIN(1.0 - (targetPauseTime / _averageScavengePauseTime), extensions->dnssMaximumContraction);
+			if ((NULL != _physicalSubArena) && _physicalSubArena->canContract(env) && (0 != maxContractionInSpace(env))) {
+				_contractionSize = MM_Math::roundToCeiling(extensions->heapAlignment, (uintptr_t)(currentSize * contractionFactor));
+				_contractionSize = MM_Math::roundToCeiling(regionSize, _contractionSize);
+				extensions->heap->getResizeStats()->setLastContractReason(SCAV_PAUSE_TOO_LONG);
+			}
+
+			/* A cohort that keeps surviving is copied once per scavenge until tenured, so tenure it sooner */
+			if ((OMR_SCV_PAUSE_TARGET_SURVIVAL_THRESHOLD <= survivalRate) && (1 < tenureAge)) {
+				tenureAge -= 1;
+			}
+		} else if (_averageScavengeTimeRatio > extensions->scavengerOverheadBudget) {
+			/* Scavenge less often, but do not grow the pause past the target */
+			double expansionFactor = OMR_MIN((_averageScavengeTimeRatio / extensions->scavengerOverheadBudget) - 1.0, extensions->dnssMaximumExpansion);
+			if (0.0 < _averageScavengePauseTime) {
+				expansionFactor = OMR_MIN(expansionFactor, (targetPauseTime / _averageScavengePauseTime) - 1.0);
+			}
+			if ((0.0 < expansionFactor) && (NULL != _physicalSubArena) && _physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))) {
+				_expansionSize = MM_Math::roundToCeiling(extensions->heapAlignment, (uintptr_t)(currentSize * expansionFactor));
+				_expansionSize = MM_Math::roundToCeiling(2 * regionSize, _expansionSize);
+				extensions->heap->getResizeStats()->setLastExpandReason(SCAV_OVERHEAD_BUDGET_EXCEEDED);
+			}
+		} else if ((_averageScavengePauseTime < (targetPauseTime / 2)) && (0.0 <= survivalRate)
+				&& (OMR_SCV_PAUSE_TARGET_SURVIVAL_THRESHOLD > survivalRate) && (OBJECT_HEADER_AGE_MAX > tenureAge)) {
+			/* The cohort is still dying, so give it another scavenge to die in the nursery rather than in tenure */
+			tenureAge += 1;
+		}
+
+		extensions->scvTenureAdaptiveTenureAge = tenureAge;
+
+		/* The tilt is applied before the resize, and the resize keeps the survivor ratio; keep the survivor space sized for the
+		 * expected flip volume rather than letting it shrink or grow with the nursery */
+		uintptr_t targetSize = currentSize + _expansionSize - _contractionSize;
+		if ((0.0 < _desiredSurvivorSpaceRatio) && (0 != targetSize) && (targetSize != currentSize)) {
+			_desiredSurvivorSpaceRatio = (_desiredSurvivorSpaceRatio * currentSize) / targetSize;
+			if (_desiredSurvivorSpaceRatio < extensions->survivorSpaceMinimumSizeRatio) {
+				_desiredSurvivorSpaceRatio = extensions->survivorSpaceMinimumSizeRatio;
+			}
+			if (_desiredSurvivorSpaceRatio > extensions->survivorSpaceMaximumSizeRatio) {
+				_desiredSurvivorSpaceRatio = extensions->survivorSpaceMaximumSizeRatio;
+			}
+		}
+
+		if(debug) {
+			omrtty_printf("\tDecision - expand:%zu contract:%zu tenure age:%zu survivor ratio:%zu\n\n",
+				_expansionSize, _contractionSize, tenureAge, (uintptr_t)(_desiredSurvivorSpaceRatio * 100));
+		}
+	}
+}
+
 /**
  * Adjust the sub space memory consumed after a collect.
  * Adjusting semi space memory consumed after a collect includes changing the tilt and/or
@@ -1022,7 +1152,11 @@ MM_MemorySubSpaceSemiSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDesc
 		flip(env, MM_MemorySubSpaceSemiSpace::restore_tilt_after_percolate);
 	} else {
 		checkSubSpaceMemoryPostCollectTilt(env);
-		checkSubSpaceMemoryPostCollectResize(env);
+		if (_extensions->isScavengerPauseTargetEnabled()) {
+			checkSubSpaceMemoryPostCollectPauseTarget(env);
+		} else {
+			checkSubSpaceMemoryPostCollectResize(env);
+		}
 	}
 	env->popVMstate(oldVMState);
 }
@@ -75,6 +75,7 @@ private:
 	uintptr_t _tiltedAverageBytesFlippedDelta;
 
 	double _averageScavengeTimeRatio;
+	double _averageScavengePauseTime; /**< Weighted average scavenge pause time in microseconds, maintained only when scavengerPauseTarget is set */
 	uint64_t _lastScavengeEndTime;
 
 	double _desiredSurvivorSpaceRatio;
@@ -102,6 +103,8 @@ private:
 
 	void checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBase *env);
 	void checkSubSpaceMemoryPostCollectResize(MM_EnvironmentBase *env);
+	void checkSubSpaceMemoryPostCollectPauseTarget(MM_EnvironmentBase *env);
+	double getTenureCohortSurvivalRate(MM_EnvironmentBase *env, uintptr_t tenureAge);
 
 protected:
 	virtual void *allocationRequestFailed(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, AllocationType allocationType, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace);
@@ -187,6 +190,7 @@ public:
 		,_tiltedAverageBytesFlipped(0)
 		,_tiltedAverageBytesFlippedDelta(0)
 		,_averageScavengeTimeRatio(0.0)
+		,_averageScavengePauseTime(0.0)
 		,_lastScavengeEndTime(0)
 		,_desiredSurvivorSpaceRatio(0.0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)		
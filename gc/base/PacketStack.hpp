@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(PACKETSTACK_HPP_)
+#define PACKETSTACK_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "Packet.hpp"
+
+/**
+ * Lock-free stack of packets. Any number of threads push packets one at a time, and the stack is
+ * only ever emptied whole, so the consumer is not exposed to ABA races with concurrent pushes.
+ * Kept apart from MM_WorkPacketsSATB so it can be exercised without a realtime build.
+ */
+class MM_PacketStack
+{
+private:
+	MM_Packet * volatile _top; /**< most recently pushed packet, NULL if the stack is empty */
+
+public:
+	/**
+	 * @return true if no packet is on the stack
+	 */
+	MMINLINE bool isEmpty() const { return NULL == _top; }
+
+	/**
+	 * Push a packet on the stack. Safe to call from many threads at once.
+	 * @param packet the packet to push, which must not be on any list
+	 */
+	MMINLINE void
+	push(MM_Packet *packet)
+	{
+		MM_Packet *top = NULL;
+		do {
+			top = _top;
+			packet->_next = top;
+		} while ((uintptr_t)top != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_top, (uintptr_t)top, (uintptr_t)packet));
+	}
+
+	/**
+	 * Detach every packet on the stack, and link them both ways, most recently pushed first,
+	 * ready to be pushed onto a MM_PacketList.
+	 * @param[out] tail the last packet of the list
+	 * @param[out] count the number of packets in the list
+	 * @return the first packet of the list, NULL (and tail and count untouched) if the stack was empty
+	 */
+	MMINLINE MM_Packet *
+	popAll(MM_Packet **tail, uintptr_t *count)
+	{
+		MM_Packet *head = NULL;
+		do {
+			head = _top;
+			if (NULL == head) {
+				return NULL;
+			}
+		} while ((uintptr_t)head != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_top, (uintptr_t)head, (uintptr_t)NULL));
+
+		uintptr_t packets = 1;
+		MM_Packet *last = head;
+		head->_previous = NULL;
+		while (NULL != last->_next) {
+			last->_next->_previous = last;
+			last = last->_next;
+			packets += 1;
+		}
+		*tail = last;
+		*count = packets;
+		return head;
+	}
+
+	MM_PacketStack()
+		: _top(NULL)
+	{
+	}
+};
+
+#endif /* PACKETSTACK_HPP_ */
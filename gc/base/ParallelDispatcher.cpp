@@ -31,6 +31,9 @@
 #include "ModronAssertions.h"
 #include "ut_j9mm.h"
 
+#include <math.h>
+
+#include "AtomicOperations.hpp"
 #include "Collector.hpp"
 #include "CollectorLanguageInterfaceImpl.hpp"
 #include "EnvironmentBase.hpp"
@@ -151,15 +154,36 @@ void
 MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env) 
 {
 	uintptr_t slaveID = env->getSlaveID();
+
+	if (_extensions->numaAwareGencon) {
+		bindSlaveToNumaNode(env);
+	}
 	
 	setThreadInitializationComplete(env);
 	
+	uintptr_t spinCount = _extensions->gcThreadParkSpinCount;
+	
 	omrthread_monitor_enter(_slaveThreadMutex);
 
 	while(slave_status_dying != _statusTable[slaveID]) {
+		if ((0 != spinCount) && (slave_status_waiting == _statusTable[slaveID])) {
+			/* Spin briefly for the next task before parking, so back-to-back tasks do not pay for a monitor wake */
+			uintptr_t generation = _taskGeneration;
+			omrthread_monitor_exit(_slaveThreadMutex);
+			for (uintptr_t spin = spinCount; (0 != spin) && (generation == _taskGeneration); spin--) {
+				MM_AtomicOperations::yieldCPU();
+			}
+			omrthread_monitor_enter(_slaveThreadMutex);
+			if (slave_status_reserved == _statusTable[slaveID]) {
+				_spinHandoffCount += 1;
+			}
+		}
+
 		/* Wait for a task to be dispatched to the slave thread */
 		while(slave_status_waiting == _statusTable[slaveID]) {
+			_parkedThreadCount += 1;
 			omrthread_monitor_wait(_slaveThreadMutex);
+			_parkedThreadCount -= 1;
 		}
 
 		if(slave_status_reserved == _statusTable[slaveID]) {
@@ -225,6 +249,10 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		forge->free(_taskTable);
 		_taskTable = NULL;
 	}
+	if(_taskAcceptTimeTable) {
+		forge->free(_taskAcceptTimeTable);
+		_taskAcceptTimeTable = NULL;
+	}
 	if(_statusTable) {
 		forge->free(_statusTable);
 		_statusTable = NULL;
@@ -270,6 +298,14 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	if (_extensions->adaptiveGCThreading) {
+		_taskAcceptTimeTable = (uint64_t *)forge->allocate(_threadCountMaximum * sizeof(uint64_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if(!_taskAcceptTimeTable) {
+			goto error_no_memory;
+		}
+		memset(_taskAcceptTimeTable, 0, _threadCountMaximum * sizeof(uint64_t));
+	}
+
 	return true;
 
 error_no_memory:
@@ -383,11 +419,20 @@ MM_ParallelDispatcher::shutDownThreads()
  * In this implementation, since slaveThreadEntryPoint() allows a thread to
  * go back to sleep if it wasn't selected, we can wake them all up. This
  * may not apply to all subclasses though.
+ * Slave threads still spinning for work see the new task generation and
+ * need no notification.
  */
 void
 MM_ParallelDispatcher::wakeUpThreads(uintptr_t count)
 {
-	omrthread_monitor_notify_all(_slaveThreadMutex);	
+	if (0 == _extensions->gcThreadParkSpinCount) {
+		omrthread_monitor_notify_all(_slaveThreadMutex);
+	} else {
+		MM_AtomicOperations::add(&_taskGeneration, 1);
+		if (0 != _parkedThreadCount) {
+			omrthread_monitor_notify_all(_slaveThreadMutex);
+		}
+	}
 }
 
 /**
@@ -428,6 +473,9 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
 	 * available and ready to run).
 	 */
 	uintptr_t taskActiveThreadCount = OMR_MIN(_activeThreadCount, threadCount);
+	if ((NULL != _taskAcceptTimeTable) && !_extensions->isMetronomeGC()) {
+		taskActiveThreadCount = adaptThreadCountForTask(env, task, taskActiveThreadCount);
+	}
 	task->setThreadCount(taskActiveThreadCount);
  	return taskActiveThreadCount;
 }
@@ -463,9 +511,77 @@ MM_ParallelDispatcher::adjustThreadCount(uintptr_t maxThreadCount)
 	return toReturn;
 }
 
+MM_ParallelDispatcher::TaskParallelism *
+MM_ParallelDispatcher::findTaskParallelism(uintptr_t vmStateID)
+{
+	for (uintptr_t i = 0; i < _taskParallelismCount; i++) {
+		if (vmStateID == _taskParallelism[i]._vmStateID) {
+			return &_taskParallelism[i];
+		}
+	}
+	return NULL;
+}
+
+uintptr_t
+MM_ParallelDispatcher::adaptThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount)
+{
+	uintptr_t result = threadCount;
+	TaskParallelism *history = findTaskParallelism(task->getVMStateID());
+
+	if (NULL != history) {
+		/* Give the task a bit more than the parallelism it could use last time, so that a task which kept
+		 * all its threads busy grows, while a task which mostly stalled shrinks towards what it can use.
+		 */
+		uintptr_t recommended = (uintptr_t)ceil(history->_parallelism * _extensions->adaptiveGCThreadingHeadroom);
+		recommended = OMR_MAX(recommended, 1);
+		if (recommended < result) {
+			result = recommended;
+		}
+		Trc_MM_ParallelDispatcher_adaptThreadCountForTask(env->getLanguageVMThread(), task->getVMStateID(), history->_parallelism, threadCount, result);
+	}
+
+	return result;
+}
+
+void
+MM_ParallelDispatcher::recordTaskParallelism(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t elapsedTime = omrtime_hires_clock() - _taskStartTime;
+
+	if (0 != elapsedTime) {
+		double sample = (double)_taskUsefulTime / (double)elapsedTime;
+		sample = OMR_MIN(sample, (double)_taskThreadCount);
+
+		TaskParallelism *history = findTaskParallelism(_taskVMStateID);
+		if (NULL != history) {
+			double weight = _extensions->adaptiveGCThreadingSampleWeight;
+			history->_parallelism = (weight * sample) + ((1.0 - weight) * history->_parallelism);
+		} else if (_taskParallelismCount < _taskParallelismHistorySize) {
+			history = &_taskParallelism[_taskParallelismCount];
+			history->_vmStateID = _taskVMStateID;
+			history->_parallelism = sample;
+			_taskParallelismCount += 1;
+		}
+
+		Trc_MM_ParallelDispatcher_recordTaskParallelism(env->getLanguageVMThread(), _taskVMStateID, _taskThreadCount,
+			omrtime_hires_delta(0, elapsedTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			omrtime_hires_delta(0, _taskUsefulTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			sample);
+	}
+}
+
 void
 MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount)
 {
+	if (NULL != _taskAcceptTimeTable) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		_taskStartTime = omrtime_hires_clock();
+		_taskUsefulTime = 0;
+		_taskVMStateID = task->getVMStateID();
+		_taskThreadCount = threadCount;
+	}
+
 	omrthread_monitor_enter(_slaveThreadMutex);
 	
 	/* Set _slaveThreadsReservedForGC to true so that shutdown will not 
@@ -492,6 +608,11 @@ MM_ParallelDispatcher::acceptTask(MM_EnvironmentBase *env)
 	_statusTable[slaveID] = slave_status_active;
 	env->_currentTask = _taskTable[slaveID];
 
+	if (NULL != _taskAcceptTimeTable) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		_taskAcceptTimeTable[slaveID] = omrtime_hires_clock();
+	}
+
 	env->_currentTask->accept(env);
 }
 
@@ -505,12 +626,27 @@ MM_ParallelDispatcher::completeTask(MM_EnvironmentBase *env)
 	env->_currentTask = NULL;
 	_taskTable[slaveID] = NULL;
 
+	if (NULL != _taskAcceptTimeTable) {
+		/* useful work is the time the thread ran the task, less the time it stalled waiting for work or other threads */
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t runTime = omrtime_hires_clock() - _taskAcceptTimeTable[slaveID];
+		uint64_t stallTime = currentTask->getThreadStallTime(env);
+		if (runTime > stallTime) {
+			MM_AtomicOperations::addU64(&_taskUsefulTime, runTime - stallTime);
+		}
+	}
+
 	currentTask->complete(env);
 }
 
 void
 MM_ParallelDispatcher::cleanupAfterTask(MM_EnvironmentBase *env)
 {
+	if (NULL != _taskAcceptTimeTable) {
+		/* all threads have completed the task, so the useful time is final */
+		recordTaskParallelism(env);
+	}
+
 	omrthread_monitor_enter(_slaveThreadMutex);
 	
 	_slaveThreadsReservedForGC = false;
@@ -531,6 +667,27 @@ MM_ParallelDispatcher::getThreadPriority()
 	return J9THREAD_PRIORITY_NORMAL;
 }
 
+/**
+ * Assign the slave thread to a NUMA node, round robin over the affinity leaders,
+ * and bind it to that node's CPUs when physical NUMA affinity is in effect.
+ */
+void
+MM_ParallelDispatcher::bindSlaveToNumaNode(MM_EnvironmentBase *env)
+{
+	uintptr_t affinityLeaderCount = 0;
+	J9MemoryNodeDetail const *affinityLeaders = _extensions->_numaManager.getAffinityLeaders(&affinityLeaderCount);
+
+	if (0 != affinityLeaderCount) {
+		uintptr_t numaNode = affinityLeaders[env->getSlaveID() % affinityLeaderCount].j9NodeNumber;
+		if (_extensions->_numaManager.isPhysicalNUMAEnabled() && _extensions->_numaManager.shouldSetCPUAffinity()) {
+			if (!env->setNumaAffinity(&numaNode, 1)) {
+				numaNode = 0;
+			}
+		}
+		env->setNumaNode(numaNode);
+	}
+}
+
 /**
  * Mark the slave thread as ready then notify everyone who is waiting
  * on the _slaveThreadMutex.
@@ -70,6 +70,10 @@ protected:
 	/* single mutex is sufficient */
 	omrthread_monitor_t _synchronizeMutex;
 	
+	volatile uintptr_t _taskGeneration; /**< Incremented whenever slave thread statuses change, so that spinning idle slaves can notice new work without the monitor */
+	uintptr_t _parkedThreadCount; /**< Number of slave threads waiting on _slaveThreadMutex (protected by _slaveThreadMutex) */
+	uintptr_t _spinHandoffCount; /**< Number of tasks picked up by slave threads while spinning, without parking (protected by _slaveThreadMutex) */
+
 	bool _slaveThreadsReservedForGC;  /**< States whether or not the slave threads are currently taking part in a GC */
 	bool _inShutdown;  /**< Shutdown request is received */
 
@@ -81,6 +85,23 @@ protected:
 	void* _handler_arg;
 	uintptr_t _defaultOSStackSize; /**< default OS stack size */
 
+	enum {
+		_taskParallelismHistorySize = 8 /**< Number of kinds of tasks (by VM state) for which parallelism is remembered */
+	};
+
+	struct TaskParallelism {
+		uintptr_t _vmStateID; /**< VM state ID identifying the kind of task */
+		double _parallelism; /**< Running average of the number of threads found busy with useful work while the task ran */
+	};
+
+	uint64_t *_taskAcceptTimeTable; /**< Per-thread hi-res time at which the current task was accepted (adaptive GC threading only) */
+	uint64_t _taskStartTime; /**< Hi-res time at which the current task was dispatched */
+	volatile uint64_t _taskUsefulTime; /**< Sum over the threads of the current task of the time spent running it, less stall time */
+	uintptr_t _taskVMStateID; /**< VM state ID of the current task */
+	uintptr_t _taskThreadCount; /**< Number of threads dispatched for the current task */
+	TaskParallelism _taskParallelism[_taskParallelismHistorySize]; /**< Measured parallelism per kind of task */
+	uintptr_t _taskParallelismCount; /**< Number of used entries in _taskParallelism */
+
 public:
 
 	/*
@@ -113,6 +134,32 @@ protected:
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
+
+	/**
+	 * Find the measured parallelism entry for the given kind of task.
+	 * @param vmStateID VM state ID of the task
+	 * @return the entry, or NULL if the kind of task has not been measured yet
+	 */
+	TaskParallelism *findTaskParallelism(uintptr_t vmStateID);
+
+	/**
+	 * Size a task to the parallelism measured on previous runs of the same kind of task.
+	 * @param task the task about to be dispatched
+	 * @param threadCount the thread count the task would otherwise be given
+	 * @return the (possibly reduced) thread count
+	 */
+	uintptr_t adaptThreadCountForTask(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount);
+
+	/**
+	 * Record the parallelism measured for the task that just completed.
+	 */
+	void recordTaskParallelism(MM_EnvironmentBase *env);
+
+	/**
+	 * Place a slave thread on one of the NUMA affinity leaders, round robin by slave ID, for NUMA aware gencon.
+	 * The node is cached in the thread's environment even if the thread can not be bound (e.g. simulated NUMA).
+	 */
+	void bindSlaveToNumaNode(MM_EnvironmentBase *env);
 	
 public:
 	virtual bool startUpThreads();
@@ -122,6 +169,7 @@ public:
 	MMINLINE virtual uintptr_t threadCountMaximum() { return _threadCountMaximum; }
 	MMINLINE omrthread_t* getThreadTable() { return _threadTable; }
 	MMINLINE virtual uintptr_t activeThreadCount() { return _activeThreadCount; }
+	MMINLINE virtual uintptr_t spinHandoffCount() { return _spinHandoffCount; }
 	virtual void setThreadCount(uintptr_t threadCount);
 
 	MMINLINE omrsig_handler_fn getSignalHandler() {return _handler;}
@@ -142,6 +190,9 @@ public:
 		,_slaveThreadMutex(NULL)
 		,_dispatcherMonitor(NULL)
 		,_synchronizeMutex(NULL)
+		,_taskGeneration(0)
+		,_parkedThreadCount(0)
+		,_spinHandoffCount(0)
 		,_slaveThreadsReservedForGC(false)
 		,_inShutdown(false)
 		,_threadCountMaximum(1)
@@ -150,6 +201,12 @@ public:
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
+		,_taskAcceptTimeTable(NULL)
+		,_taskStartTime(0)
+		,_taskUsefulTime(0)
+		,_taskVMStateID(0)
+		,_taskThreadCount(0)
+		,_taskParallelismCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "mmprivatehook.h"
+
+#include "ParallelHeapPreTouchTask.hpp"
+
+#include "AtomicOperations.hpp"
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "Math.hpp"
+
+/* Smallest unit of the range handed to a thread, so that small expansions are not split into slivers */
+#define HEAP_PRETOUCH_MINIMUM_CHUNK_SIZE ((uintptr_t)1 << 20)
+/* Number of chunks per thread, to balance threads which are slowed by page fault contention */
+#define HEAP_PRETOUCH_CHUNKS_PER_THREAD 8
+
+void
+MM_ParallelHeapPreTouchTask::touchPages(void *lowAddress, void *highAddress, uintptr_t pageSize)
+{
+	for (uintptr_t page = (uintptr_t)lowAddress; page < (uintptr_t)highAddress; page += pageSize) {
+		MM_AtomicOperations::add((volatile uintptr_t *)page, 0);
+	}
+}
+
+void
+MM_ParallelHeapPreTouchTask::run(MM_EnvironmentBase *env)
+{
+	uintptr_t threadCount = getThreadCount();
+	uintptr_t chunkIndex = 0;
+
+	for (uintptr_t chunkBase = (uintptr_t)_lowAddress; chunkBase < (uintptr_t)_highAddress; chunkBase += _chunkSize) {
+		bool touchChunk = false;
+		if (_interleaved) {
+			touchChunk = (env->getSlaveID() == (chunkIndex % threadCount));
+			chunkIndex += 1;
+		} else {
+			touchChunk = J9MODRON_HANDLE_NEXT_WORK_UNIT(env);
+		}
+		if (touchChunk) {
+			uintptr_t chunkTop = OMR_MIN(chunkBase + _chunkSize, (uintptr_t)_highAddress);
+			touchPages((void *)chunkBase, (void *)chunkTop, _pageSize);
+		}
+	}
+}
+
+void
+MM_ParallelHeapPreTouchTask::preTouch(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	if (extensions->heapPreTouch && (NULL != env->getOmrVMThread()) && (lowAddress < highAddress)) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		MM_Dispatcher *dispatcher = extensions->dispatcher;
+		uintptr_t size = (uintptr_t)highAddress - (uintptr_t)lowAddress;
+		uintptr_t pageSize = OMR_MAX(extensions->heap->getPageSize(), (uintptr_t)omrvmem_supported_page_sizes()[0]);
+		uintptr_t threadCount = 1;
+		bool interleaved = false;
+		uint64_t startTime = omrtime_hires_clock();
+
+		/* The dispatcher can only be borrowed when no other task is running on it, and is not worth waking for a single chunk */
+		if ((NULL != dispatcher) && (NULL == env->_currentTask) && !extensions->isConcurrentScavengerInProgress() && (HEAP_PRETOUCH_MINIMUM_CHUNK_SIZE < size)) {
+			uintptr_t chunkSize = size / (dispatcher->activeThreadCount() * HEAP_PRETOUCH_CHUNKS_PER_THREAD);
+			chunkSize = MM_Math::roundToCeiling(pageSize, OMR_MAX(chunkSize, HEAP_PRETOUCH_MINIMUM_CHUNK_SIZE));
+			uintptr_t chunkCount = MM_Math::roundToCeiling(chunkSize, size) / chunkSize;
+			/* With NUMA aware GC threads, hand out chunks round robin so that the first touches (and so the pages) are interleaved over the nodes */
+			interleaved = extensions->numaAwareGencon && (1 < extensions->_numaManager.getAffinityLeaderCount());
+
+			MM_ParallelHeapPreTouchTask preTouchTask(env, dispatcher, lowAddress, highAddress, pageSize, chunkSize, interleaved);
+			dispatcher->run(env, &preTouchTask, chunkCount);
+			threadCount = preTouchTask.getThreadCount();
+		} else {
+			touchPages(lowAddress, highAddress, pageSize);
+		}
+
+		uint64_t endTime = omrtime_hires_clock();
+		TRIGGER_J9HOOK_MM_PRIVATE_HEAP_PRETOUCH(
+			extensions->privateHookInterface,
+			env->getOmrVMThread(),
+			endTime,
+			J9HOOK_MM_PRIVATE_HEAP_PRETOUCH,
+			lowAddress,
+			size,
+			threadCount,
+			interleaved ? TRUE : FALSE,
+			omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+	}
+}
+
+void
+MM_ParallelHeapPreTouchTask::preTouchCommittedHeap(MM_EnvironmentBase *env)
+{
+	MM_HeapRegionManager *regionManager = env->getExtensions()->heap->getHeapRegionManager();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (region->isCommitted()) {
+			preTouch(env, region->getLowAddress(), region->getHighAddress());
+		}
+	}
+}
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(PARALLELHEAPPRETOUCHTASK_HPP_)
+#define PARALLELHEAPPRETOUCHTASK_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#include "ParallelTask.hpp"
+
+class MM_Dispatcher;
+class MM_EnvironmentBase;
+
+/**
+ * Touch every page of a committed heap range on the GC threads, so that the page faults for fresh memory are
+ * taken in parallel up front rather than by the first mutator to allocate a TLH from the range.
+ * The touch is an atomic add of zero, which leaves the contents of the range unchanged, so it is safe to apply
+ * to memory which is already in use.
+ * @ingroup GC_Base
+ */
+class MM_ParallelHeapPreTouchTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	void *_lowAddress; /**< First address of the range to touch */
+	void *_highAddress; /**< Address following the last address of the range to touch */
+	uintptr_t _pageSize; /**< Stride between touches */
+	uintptr_t _chunkSize; /**< Size of the units the range is divided into among the threads (a multiple of _pageSize) */
+	bool _interleaved; /**< If true, chunks are assigned to threads round robin rather than by work unit, spreading the pages over the NUMA nodes the threads are bound to */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Touch one word in each page of [lowAddress, highAddress).
+	 */
+	static void touchPages(void *lowAddress, void *highAddress, uintptr_t pageSize);
+
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PERFORM_RESIZE; }
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	/**
+	 * Pre-touch a newly committed heap range, in parallel on the dispatcher threads if they are available to
+	 * the caller and serially otherwise, and report the time taken through J9HOOK_MM_PRIVATE_HEAP_PRETOUCH.
+	 * Does nothing unless heapPreTouch is enabled or if the calling environment has no thread (the heap is
+	 * still being initialized, and will be touched by preTouchCommittedHeap() once the GC threads are started).
+	 * @param env[in] the current thread
+	 * @param lowAddress[in] first address of the range
+	 * @param highAddress[in] address following the last address of the range
+	 */
+	static void preTouch(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
+	/**
+	 * Pre-touch every committed heap region. Called once the dispatcher threads have been started.
+	 * @param env[in] the current thread
+	 */
+	static void preTouchCommittedHeap(MM_EnvironmentBase *env);
+
+	/**
+	 * Create a ParallelHeapPreTouchTask object.
+	 */
+	MM_ParallelHeapPreTouchTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, void *lowAddress, void *highAddress, uintptr_t pageSize, uintptr_t chunkSize, bool interleaved)
+		: MM_ParallelTask(env, dispatcher)
+		, _lowAddress(lowAddress)
+		, _highAddress(highAddress)
+		, _pageSize(pageSize)
+		, _chunkSize(chunkSize)
+		, _interleaved(interleaved)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* PARALLELHEAPPRETOUCHTASK_HPP_ */
@@ -30,7 +30,9 @@
 #include "ParallelMarkTask.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "MarkingScheme.hpp"
+#include "WorkPackets.hpp"
 #include "WorkStack.hpp"
 
 
@@ -64,6 +66,18 @@ MM_ParallelMarkTask::setup(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_ParallelMarkTask::masterSetup(MM_EnvironmentBase *env)
+{
+	_markingScheme->getWorkPackets()->startWorkStealing(env, getThreadCount());
+}
+
+void
+MM_ParallelMarkTask::masterCleanup(MM_EnvironmentBase *env)
+{
+	_markingScheme->getWorkPackets()->stopWorkStealing(env);
+}
+
 void
 MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 {
@@ -90,6 +104,14 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 		env->_workPacketStats.workPacketsReleased,
 		env->_workPacketStats.workPacketsExchanged,
 		0/* TODO CRG figure out to get the array split size*/);
+
+	if (env->getExtensions()->workStealingMark) {
+		Trc_MM_ParallelMarkTask_workStealingStats(
+			env->getLanguageVMThread(),
+			(uint32_t)env->getSlaveID(),
+			env->_workPacketStats.workPacketStealAttempts,
+			env->_workPacketStats.workPacketsStolen);
+	}
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -127,5 +149,11 @@ MM_ParallelMarkTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBa
 	return result;
 }
 
+uint64_t
+MM_ParallelMarkTask::getThreadStallTime(MM_EnvironmentBase *env)
+{
+	return env->_workPacketStats.getStallTime() + env->_markStats.getStallTime();
+}
+
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
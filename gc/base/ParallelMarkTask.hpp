@@ -55,11 +55,14 @@ public:
 	virtual void run(MM_EnvironmentBase *env);
 	virtual void setup(MM_EnvironmentBase *env);
 	virtual void cleanup(MM_EnvironmentBase *env);
+	virtual void masterSetup(MM_EnvironmentBase *env);
+	virtual void masterCleanup(MM_EnvironmentBase *env);
 	
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	virtual void synchronizeGCThreads(MM_EnvironmentBase *env, const char *id);
 	virtual bool synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, const char *id);
 	virtual bool synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id);
+	virtual uint64_t getThreadStallTime(MM_EnvironmentBase *env);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	/**
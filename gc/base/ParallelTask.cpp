@@ -33,6 +33,21 @@
 
 #include "ModronAssertions.h"
 
+void
+MM_ParallelTask::spinBeforeWait(MM_EnvironmentBase *env, uintptr_t index, bool stopWhenAllSynchronized)
+{
+	uintptr_t spin = env->getExtensions()->gcThreadParkSpinCount;
+
+	if (0 != spin) {
+		omrthread_monitor_exit(_synchronizeMutex);
+		while ((0 != spin) && (index == _synchronizeIndex) && !(stopWhenAllSynchronized && (_synchronizeCount == _threadCount))) {
+			MM_AtomicOperations::yieldCPU();
+			spin -= 1;
+		}
+		omrthread_monitor_enter(_synchronizeMutex);
+	}
+}
+
 bool
 MM_ParallelTask::handleNextWorkUnit(MM_EnvironmentBase *env)
 {
@@ -99,9 +114,10 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 		} else {
 			volatile uintptr_t index = _synchronizeIndex;
 
-			do {
+			spinBeforeWait(env, index, false);
+			while(index == _synchronizeIndex) {
 				omrthread_monitor_wait(_synchronizeMutex);
-			} while(index == _synchronizeIndex);
+			}
 		}
 		omrthread_monitor_exit(_synchronizeMutex);
 
@@ -145,6 +161,7 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, c
 			omrthread_monitor_notify_all(_synchronizeMutex);
 		}
 
+		spinBeforeWait(env, index, env->isMasterThread());
 		while(index == _synchronizeIndex) {
 			if(env->isMasterThread() && (_synchronizeCount == _threadCount)) {
 				omrthread_monitor_exit(_synchronizeMutex);
@@ -198,9 +215,10 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 			goto done;
 		}
 
-		do {
+		spinBeforeWait(env, index, false);
+		while(index == _synchronizeIndex) {
 			omrthread_monitor_wait(_synchronizeMutex);
-		} while(index == _synchronizeIndex);
+		}
 		omrthread_monitor_exit(_synchronizeMutex);
 	} else {
 		_synchronized = true;
@@ -271,6 +289,15 @@ MM_ParallelTask::complete(MM_EnvironmentBase *env)
 	
 		if(env->isMasterThread()) {
 			/* Synchronization on exit - cannot delete the task object until all threads are done with it */
+			uintptr_t spin = env->getExtensions()->gcThreadParkSpinCount;
+			if ((0 != spin) && (0 != _threadCount)) {
+				omrthread_monitor_exit(_synchronizeMutex);
+				while ((0 != spin) && (0 != _threadCount)) {
+					MM_AtomicOperations::yieldCPU();
+					spin -= 1;
+				}
+				omrthread_monitor_enter(_synchronizeMutex);
+			}
 			while(0 != _threadCount) {
 				omrthread_monitor_wait(_synchronizeMutex);
 			}
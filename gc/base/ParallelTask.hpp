@@ -59,6 +59,15 @@ protected:
 	volatile uintptr_t _synchronizeIndex;
 	volatile uintptr_t _synchronizeCount;
 	omrthread_monitor_t _synchronizeMutex;
+
+	/**
+	 * Spin briefly, with the synchronize mutex released, while waiting to be released from a sync point, so that
+	 * short waits are not paid for with a monitor wait and notify. The caller re-checks its wait condition and parks
+	 * on the monitor if still needed. Must be called with _synchronizeMutex held; returns with it held.
+	 * @param index the sync point index the caller is waiting to see advance
+	 * @param stopWhenAllSynchronized also stop spinning once all threads have reached the sync point
+	 */
+	void spinBeforeWait(MM_EnvironmentBase *env, uintptr_t index, bool stopWhenAllSynchronized);
 public:
 	
 	/*
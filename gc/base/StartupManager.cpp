@@ -37,6 +37,10 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCCOMPACT_INCREMENTAL_WINDOW_PERCENTAGE "-Xgc:compactIncrementalWindowPercentage="
+#define OMR_XGCCOMPACT_INCREMENTAL_WINDOW_PERCENTAGE_LENGTH 40
+#define OMR_XGCCOMPACT_INCREMENTAL "-Xgc:compactIncremental"
+#define OMR_XGCCOMPACT_INCREMENTAL_LENGTH 23
 #endif /* OMR_GC_MODRON_COMPACTION */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
@@ -48,8 +52,32 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCBINARY_LOGGING "-Xgc:binaryLogging"
+#define OMR_XGCBINARY_LOGGING_LENGTH 18
+#define OMR_XGCHEAP_PRETOUCH "-Xgc:heapPreTouch"
+#define OMR_XGCHEAP_PRETOUCH_LENGTH 17
+#define OMR_XGCALLOCATION_SAMPLING_INTERVAL "-Xgc:allocationSamplingInterval="
+#define OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH 32
+#define OMR_XGCMARKING_PREFETCH_DEPTH "-Xgc:markingPrefetchDepth="
+#define OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH 26
+#define OMR_XGCSCAVENGER_SURVIVAL_CENSUS "-Xgc:scavengerSurvivalCensus"
+#define OMR_XGCSCAVENGER_SURVIVAL_CENSUS_LENGTH 28
+#define OMR_XGCSCAVENGER_PAUSE_TARGET "-Xgc:scavengerPauseTarget="
+#define OMR_XGCSCAVENGER_PAUSE_TARGET_LENGTH 26
+#define OMR_XGCSCAVENGER_OVERHEAD_BUDGET "-Xgc:scavengerOverheadBudget="
+#define OMR_XGCSCAVENGER_OVERHEAD_BUDGET_LENGTH 29
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCLAZY_SWEEP_SEGREGATED "-Xgc:lazySweepSegregated"
+#define OMR_XGCLAZY_SWEEP_SEGREGATED_LENGTH 24
+#define OMR_XGCSEGREGATED_ALLOCATION_CONTEXT_PER_CPU "-Xgc:segregatedAllocationContextPerCPU"
+#define OMR_XGCSEGREGATED_ALLOCATION_CONTEXT_PER_CPU_LENGTH 38
+#define OMR_XGCSIZE_CLASS_SAMPLING_INTERVAL "-Xgc:sizeClassSamplingInterval="
+#define OMR_XGCSIZE_CLASS_SAMPLING_INTERVAL_LENGTH 31
+#define OMR_XGCSIZE_CLASS_PROFILE "-Xgc:sizeClassProfile="
+#define OMR_XGCSIZE_CLASS_PROFILE_LENGTH 22
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -264,6 +292,17 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCCOMPACT_INCREMENTAL_WINDOW_PERCENTAGE, OMR_XGCCOMPACT_INCREMENTAL_WINDOW_PERCENTAGE_LENGTH)) {
+		uintptr_t windowPercentage = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCCOMPACT_INCREMENTAL_WINDOW_PERCENTAGE_LENGTH, &windowPercentage)) || (0 == windowPercentage) || (100 < windowPercentage)) {
+			result = false;
+		} else {
+			extensions->compactIncrementalWindowPercentage = windowPercentage;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCCOMPACT_INCREMENTAL, OMR_XGCCOMPACT_INCREMENTAL_LENGTH)) {
+		extensions->compactIncremental = true;
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
@@ -276,6 +315,49 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCBINARY_LOGGING, OMR_XGCBINARY_LOGGING_LENGTH)) {
+		extensions->binaryLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCHEAP_PRETOUCH, OMR_XGCHEAP_PRETOUCH_LENGTH)) {
+		extensions->heapPreTouch = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCALLOCATION_SAMPLING_INTERVAL, OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH)) {
+		uintptr_t value = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCALLOCATION_SAMPLING_INTERVAL_LENGTH, &value)) {
+			result = false;
+		} else {
+			extensions->allocationSamplingInterval = value;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCMARKING_PREFETCH_DEPTH, OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH)) {
+		uintptr_t prefetchDepth = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCMARKING_PREFETCH_DEPTH_LENGTH, &prefetchDepth)) || (MARKING_PREFETCH_DEPTH_MAX < prefetchDepth)) {
+			result = false;
+		} else {
+			extensions->markingPrefetchDepth = prefetchDepth;
+		}
+	}
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_SURVIVAL_CENSUS, OMR_XGCSCAVENGER_SURVIVAL_CENSUS_LENGTH)) {
+		extensions->scavengerSurvivalCensus = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_PAUSE_TARGET, OMR_XGCSCAVENGER_PAUSE_TARGET_LENGTH)) {
+		uintptr_t pauseTarget = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSCAVENGER_PAUSE_TARGET_LENGTH, &pauseTarget)) {
+			result = false;
+		} else {
+			extensions->scavengerPauseTarget = pauseTarget;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSCAVENGER_OVERHEAD_BUDGET, OMR_XGCSCAVENGER_OVERHEAD_BUDGET_LENGTH)) {
+		uintptr_t overheadPercent = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCSCAVENGER_OVERHEAD_BUDGET_LENGTH, &overheadPercent)) || (0 == overheadPercent) || (100 <= overheadPercent)) {
+			result = false;
+		} else {
+			extensions->scavengerOverheadBudget = (double)overheadPercent / 100.0;
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -287,6 +369,33 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		}
 	}
 #endif /* defined(OMR_GC_MORDON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCLAZY_SWEEP_SEGREGATED, OMR_XGCLAZY_SWEEP_SEGREGATED_LENGTH)) {
+		extensions->lazySweepSegregated = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATED_ALLOCATION_CONTEXT_PER_CPU, OMR_XGCSEGREGATED_ALLOCATION_CONTEXT_PER_CPU_LENGTH)) {
+		extensions->segregatedAllocationContextPerCPU = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSIZE_CLASS_SAMPLING_INTERVAL, OMR_XGCSIZE_CLASS_SAMPLING_INTERVAL_LENGTH)) {
+		uintptr_t samplingInterval = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSIZE_CLASS_SAMPLING_INTERVAL_LENGTH, &samplingInterval)) {
+			result = false;
+		} else {
+			extensions->sizeClassSamplingInterval = samplingInterval;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSIZE_CLASS_PROFILE, OMR_XGCSIZE_CLASS_PROFILE_LENGTH)) {
+		if (NULL != extensions->sizeClassProfile) {
+			omrmem_free_memory(extensions->sizeClassProfile);
+		}
+		extensions->sizeClassProfile = (char *) omrmem_allocate_memory(strlen(option + OMR_XGCSIZE_CLASS_PROFILE_LENGTH) + 1, OMRMEM_CATEGORY_MM);
+		if (NULL == extensions->sizeClassProfile) {
+			result = false;
+		} else {
+			strcpy(extensions->sizeClassProfile, option + OMR_XGCSIZE_CLASS_PROFILE_LENGTH);
+		}
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 	else if (0 == strncmp(option, OMR_XGCTHREADS, OMR_XGCTHREADS_LENGTH)) {
 		uintptr_t forcedThreadCount = 0;
 		if (0 >= getUDATAValue(option + OMR_XGCTHREADS_LENGTH, &forcedThreadCount)) {
@@ -37,6 +37,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AllocationContext.hpp"
+#include "AllocationSiteStats.hpp"
 #include "AllocationStats.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
@@ -113,6 +114,7 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	if(shouldFlush) {
 		_abandonedList = NULL;
 		_abandonedListSize = 0;
+		_batchedList = NULL;
 		clear(env);
 	} else {
 		/* Clear current information accumulated */
@@ -163,6 +165,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 	uintptr_t halfRefreshSize = getRefreshSize() >> 1;
 	uintptr_t abandonSize = (tlhMinimumSize > halfRefreshSize ? tlhMinimumSize : halfRefreshSize);
 	if (sizeInBytesRequired > abandonSize) {
+		/* the request is satisfied outside of the TLH */
+		if (0 != extensions->allocationSamplingInterval) {
+			sampleAllocation(env, allocDescription, sizeInBytesRequired);
+		}
 		/* increase thread hungriness if we did not refresh */
 		if (getRefreshSize() < tlhMaximumSize && sizeInBytesRequired < tlhMaximumSize) {
 			setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
@@ -172,6 +178,10 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 
 	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
 
+	if (0 != extensions->allocationSamplingInterval) {
+		sampleAllocation(env, allocDescription, (uintptr_t)getRealAlloc() - (uintptr_t)getBase());
+	}
+
 	stats->_tlhDiscardedBytes += getSize();
 
 	/* Try to cache the current TLH */
@@ -221,10 +231,37 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 		stats->_tlhAllocatedReused += getSize();
 		stats->_tlhDiscardedBytes -= getSize();
 
+		didRefresh = true;
+	} else if ((NULL != _batchedList) && (sizeInBytesRequired <= _batchedList->getSize())) {
+		/* Take a TLH carved out of an earlier batched refresh */
+		setupTLH(env, (void *)_batchedList, (void *)_batchedList->afterEnd(),
+				_batchedList->_memorySubSpace, _batchedList->_memoryPool);
+		_batchedList = (MM_HeapLinkedFreeHeaderTLH *)_batchedList->getNext(compressed);
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		if (_zeroTLH) {
+			if (0 != extensions->batchClearTLH) {
+				memset(getBase(), 0, sizeof(MM_HeapLinkedFreeHeaderTLH));
+			}
+		}
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
+
+		allocDescription->setTLHAllocation(true);
+		allocDescription->setNurseryAllocation(getMemorySubSpace()->getTypeFlags() == MEMORY_TYPE_NEW);
+		allocDescription->setMemoryPool(getMemoryPool());
+
+		/* The piece is fresh memory, accounted only now that it is handed out */
+		stats->_tlhRefreshCountFresh += 1;
+		stats->_tlhRefreshCountBatched += 1;
+		stats->_tlhAllocatedFresh += getSize();
+
 		didRefresh = true;
 	} else {
 		/* Try allocating a fresh TLH */
 		MM_AllocationContext *ac = env->getAllocationContext();
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		_refreshPreZeroed = false;
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 		MM_MemorySpace *memorySpace = _objectAllocationInterface->getOwningEnv()->getMemorySpace();
 
 		if (NULL != ac) {
@@ -243,7 +280,13 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 				if (0 != extensions->batchClearTLH) {
 					void *base = getBase();
 					void *top = getTop();
-					OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					if (_refreshPreZeroed) {
+						/* Only the free entry header has been written since the scavenger zeroed this memory */
+						memset(base, 0, sizeof(MM_HeapLinkedFreeHeader));
+						stats->_tlhRefreshCountPreZeroed += 1;
+					} else {
+						OMRZeroMemory(base, (uintptr_t)top - (uintptr_t)base);
+					}
 				}
 			}
 #endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
@@ -333,8 +376,18 @@ void *
 MM_TLHAllocationSupport::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool)
 {
 	void *addrBase, *addrTop;
-
-	if(memoryPool->allocateTLH(env, allocDescription, getRefreshSize(), addrBase, addrTop)) {
+	uintptr_t refreshSize = getRefreshSize();
+	uintptr_t batchCount = env->getExtensions()->tlhRefreshBatchCount;
+
+	if(memoryPool->allocateTLH(env, allocDescription, refreshSize * batchCount, addrBase, addrTop)) {
+#if defined(OMR_GC_BATCH_CLEAR_TLH) && defined(OMR_GC_MODRON_SCAVENGER)
+		/* Claim even for a secondary TLH, so that the pool knows the range is no longer zeroed */
+		bool preZeroed = memoryPool->claimPreZeroedRange(env, addrBase, addrTop);
+		_refreshPreZeroed = _zeroTLH && preZeroed;
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) && defined(OMR_GC_MODRON_SCAVENGER) */
+		if (1 < batchCount) {
+			addrTop = cacheBatchedTLHs(env, addrBase, addrTop, refreshSize, memorySubSpace, memoryPool);
+		}
 		setupTLH(env, addrBase, addrTop, memorySubSpace, memoryPool);
 		allocDescription->setMemorySubSpace(memorySubSpace);
 		allocDescription->setObjectFlags(memorySubSpace->getObjectFlags());
@@ -343,12 +396,70 @@ MM_TLHAllocationSupport::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescrip
 	return NULL;
 }
 
+/**
+ * Split the memory of a batched refresh into TLHs.
+ * The first refreshSize bytes become the new TLH, and the rest is carved into refreshSize pieces pushed on the
+ * batched list, from which subsequent refreshes are satisfied without taking the memory pool lock.  A remainder
+ * too small to be reused is folded into the last piece (or into the TLH itself).  Pieces are accounted as fresh
+ * TLHs when they are handed out, not here.
+ *
+ * @return the top of the new TLH
+ */
+void *
+MM_TLHAllocationSupport::cacheBatchedTLHs(MM_EnvironmentBase *env, void *addrBase, void *addrTop, uintptr_t refreshSize, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	bool const compressed = extensions->compressObjectReferences();
+	uintptr_t tlhMinimumSize = extensions->tlhMinimumSize;
+	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
+	uint8_t *tlhTop = (uint8_t *)addrBase + refreshSize;
+
+	if (((uint8_t *)addrTop < tlhTop) || (((uintptr_t)addrTop - (uintptr_t)tlhTop) < tlhMinimumSize)) {
+		/* Nothing worth caching - the whole allocation is the TLH */
+		return addrTop;
+	}
+
+	uint8_t *pieceBase = tlhTop;
+	while (pieceBase < (uint8_t *)addrTop) {
+		uint8_t *pieceTop = pieceBase + refreshSize;
+		if (((uintptr_t)addrTop - (uintptr_t)pieceBase) < (refreshSize + tlhMinimumSize)) {
+			pieceTop = (uint8_t *)addrTop;
+		}
+		uintptr_t pieceSize = (uintptr_t)pieceTop - (uintptr_t)pieceBase;
+
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		/* Pieces are reused with only their header cleared, so clear them in full now (unless the scavenger already has) */
+		if (_zeroTLH && !_refreshPreZeroed) {
+			if (0 != extensions->batchClearTLH) {
+				OMRZeroMemory(pieceBase, pieceSize);
+			}
+		}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
+		MM_HeapLinkedFreeHeaderTLH *piece = (MM_HeapLinkedFreeHeaderTLH *)pieceBase;
+#if defined(OMR_VALGRIND_MEMCHECK)
+		valgrindMakeMemUndefined((uintptr_t)piece, sizeof(MM_HeapLinkedFreeHeaderTLH));
+#endif /* defined(OMR_VALGRIND_MEMCHECK) */
+		piece->setSize(pieceSize);
+		piece->_memoryPool = memoryPool;
+		piece->_memorySubSpace = memorySubSpace;
+		piece->setNext(_batchedList, compressed);
+		_batchedList = piece;
+		stats->_tlhBatchedCount += 1;
+
+		pieceBase = pieceTop;
+	}
+
+	return tlhTop;
+}
+
 void
 MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 {
 	/* Since AllocationStats have been reset, reset the base as well*/
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
+	_batchedList = NULL;
 	clear(env);
 }
 
@@ -396,6 +507,48 @@ MM_TLHAllocationSupport::updateFrequentObjectsStats(MM_EnvironmentBase *env)
 	}
 }
 
+/**
+ * Randomize the distance to the next allocation site sample uniformly over [interval/2, 3*interval/2), so
+ * that sites allocating in a fixed pattern relative to the TLH refreshes are not systematically skipped.
+ */
+static MMINLINE uintptr_t
+nextAllocationSampleDistance(MM_EnvironmentBase *env, uintptr_t interval)
+{
+	uint32_t seed = env->_allocationSampleSeed;
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	env->_allocationSampleSeed = seed;
+	return (interval / 2) + (seed % interval) + 1;
+}
+
+void
+MM_TLHAllocationSupport::sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t allocatedBytes)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t interval = extensions->allocationSamplingInterval;
+
+	if (0 == env->_allocationSampleThreshold) {
+		/* first refresh of this thread: seed the generator (it must not be 0) and pick the first distance */
+		env->_allocationSampleSeed = (uint32_t)((uintptr_t)env >> 4) | 1;
+		env->_allocationSampleThreshold = nextAllocationSampleDistance(env, interval);
+	}
+
+	env->_allocationSampleBytes += allocatedBytes;
+	if (env->_allocationSampleBytes >= env->_allocationSampleThreshold) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uintptr_t sampledBytes = env->_allocationSampleBytes;
+		uintptr_t allocationSite = allocDescription->getAllocationSite();
+
+		env->_allocationSampleBytes = 0;
+		env->_allocationSampleThreshold = nextAllocationSampleDistance(env, interval);
+
+		extensions->allocationSiteStats->update(env, allocationSite, sampledBytes);
+		TRIGGER_J9HOOK_MM_OMR_ALLOCATION_SAMPLED(extensions->omrHookInterface, env->getOmrVMThread(), omrtime_hires_clock(),
+				allocationSite, allocDescription->getBytesRequested(), sampledBytes);
+	}
+}
+
 #if defined(OMR_GC_OBJECT_ALLOCATION_NOTIFY)
 void
 MM_TLHAllocationSupport::objectAllocationNotify(MM_EnvironmentBase *env, void *heapBase, void *heapTop)
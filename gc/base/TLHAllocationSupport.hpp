@@ -80,13 +80,18 @@ private:
 
 	MM_HeapLinkedFreeHeaderTLH *_abandonedList; /**< List of abandoned TLHs. Shaped like a free list. */
 	uintptr_t _abandonedListSize; /**< Number of entries in the abandoned list. */
+	MM_HeapLinkedFreeHeaderTLH *_batchedList; /**< TLHs carved out of batched fresh refreshes and not yet handed out. Shaped like a free list. */
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	bool _refreshPreZeroed; /**< true if the memory of the current fresh refresh was zeroed by the scavenger and has only its free entry header to clear */
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
 
 public:
 protected:
 private:
 	void *allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
+	void *cacheBatchedTLHs(MM_EnvironmentBase *env, void *addrBase, void *addrTop, uintptr_t refreshSize, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
 
 	void flushCache(MM_EnvironmentBase *env);
 
@@ -172,6 +177,13 @@ private:
 
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env);
 
+	/**
+	 * Count bytes allocated by the thread towards its next allocation site sample. Once the (randomized)
+	 * sampling distance is reached, the bytes are attributed to the site of the allocation being satisfied.
+	 * @param allocatedBytes bytes allocated since the last call
+	 */
+	void sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, uintptr_t allocatedBytes);
+
 	/**
 	 * Create a ThreadLocalHeap object.
 	 */
@@ -185,7 +197,11 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
+		_batchedList(NULL),
 		_zeroTLH(zeroTLH)
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		, _refreshPreZeroed(false)
+#endif /* OMR_GC_BATCH_CLEAR_TLH */
 	{};
 
 	/*
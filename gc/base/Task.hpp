@@ -76,6 +76,14 @@ public:
 	MMINLINE virtual void setThreadCount(uintptr_t threadCount) { assume0(1 == threadCount); }
 	MMINLINE virtual uintptr_t getThreadCount() { return 1; }
 
+	/**
+	 * Return the time the thread spent stalled (waiting for work or for other threads) while running this task.
+	 * Used by the dispatcher to measure the parallelism available to the task.
+	 * @param env[in] the thread which ran the task
+	 * @return the stall time in hi-res ticks, or 0 if the task does not track it
+	 */
+	virtual uint64_t getThreadStallTime(MM_EnvironmentBase *env) { return 0; }
+
 	MMINLINE virtual void setSynchronizeMutex(omrthread_monitor_t synchronizeMutex)
 	{
 		/* in a Task we don't need a mutex */
@@ -120,6 +120,20 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	if (_extensions->workStealingMark) {
+		_deques = (MM_WorkStealingDeque *)env->getForge()->allocate(sizeof(MM_WorkStealingDeque) * _extensions->gcThreadCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _deques) {
+			return false;
+		}
+		for (; _dequeCount < _extensions->gcThreadCount; _dequeCount++) {
+			new(&_deques[_dequeCount]) MM_WorkStealingDeque();
+			if (!_deques[_dequeCount].initialize(env, _extensions->workStealingDequeSize)) {
+				_dequeCount += 1;
+				return false;
+			}
+		}
+	}
+
 	if(0 != _extensions->workpacketCount) {
 		/* -Xgcworkpackets was specified, so base the number on that */
 		initialPacketCount = _extensions->workpacketCount;
@@ -247,6 +261,15 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 	_relativelyFullPacketList.tearDown(env);
 	_deferredPacketList.tearDown(env);
 	_deferredFullPacketList.tearDown(env);
+
+	if (NULL != _deques) {
+		for (uintptr_t i = 0; i < _dequeCount; i++) {
+			_deques[i].tearDown(env);
+		}
+		env->getForge()->free(_deques);
+		_deques = NULL;
+		_dequeCount = 0;
+	}
 }
 
 void
@@ -332,11 +355,113 @@ MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
 	bool res = 	((!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
 				|| (!_nonEmptyPacketList.isEmpty())
-				|| (!_overflowHandler->isEmpty()));
+				|| (!_overflowHandler->isEmpty())
+				|| dequedPacketAvailable());
 				
 	return res;
 }
 
+/**
+ * Returns TRUE if a deque of any thread participating in work stealing holds a packet, FALSE otherwise.
+ */
+bool
+MM_WorkPackets::dequedPacketAvailable()
+{
+	if (_workStealingActive) {
+		for (uintptr_t i = 0; i < _workStealingThreadCount; i++) {
+			if (!_deques[i].isEmpty()) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+MM_WorkStealingDeque *
+MM_WorkPackets::getOwnerDeque(MM_EnvironmentBase *env)
+{
+	MM_WorkStealingDeque *deque = NULL;
+
+	/* only threads dispatched for the task own a deque; their slave IDs are unique for the task */
+	if (_workStealingActive && (NULL != env->_currentTask) && (env->getSlaveID() < _workStealingThreadCount)) {
+		deque = &_deques[env->getSlaveID()];
+	}
+
+	return deque;
+}
+
+/**
+ * Try to steal a packet from the deques of the other participating threads, starting with the
+ * thread following the current one so that thieves spread over different victims.
+ *
+ * @return a packet if one is stolen, NULL otherwise
+ */
+MM_Packet *
+MM_WorkPackets::getPacketByStealing(MM_EnvironmentBase *env)
+{
+	uintptr_t threadCount = _workStealingThreadCount;
+	uintptr_t victimIndex = env->getSlaveID();
+
+	for (uintptr_t i = 1; i < threadCount; i++) {
+		victimIndex += 1;
+		if (victimIndex >= threadCount) {
+			victimIndex = 0;
+		}
+		MM_WorkStealingDeque *victim = &_deques[victimIndex];
+		if (!victim->isEmpty()) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketStealAttempts += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			MM_Packet *packet = victim->steal();
+			if (NULL != packet) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				env->_workPacketStats.workPacketsStolen += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				packet->setOwner(env);
+				return packet;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Return all packets held by the deque to the shared lists. Must be called by the deque owner
+ * (or once no other thread is using the deque).
+ */
+void
+MM_WorkPackets::flushDeque(MM_EnvironmentBase *env, MM_WorkStealingDeque *deque)
+{
+	MM_Packet *packet = NULL;
+	while (NULL != (packet = deque->pop())) {
+		putPacket(env, packet);
+	}
+}
+
+void
+MM_WorkPackets::startWorkStealing(MM_EnvironmentBase *env, uintptr_t threadCount)
+{
+	/* a single thread has nobody to steal from, so the shared lists serve it just as well */
+	if ((NULL != _deques) && (1 < threadCount)) {
+		_workStealingThreadCount = OMR_MIN(threadCount, _dequeCount);
+		_workStealingActive = true;
+	}
+}
+
+void
+MM_WorkPackets::stopWorkStealing(MM_EnvironmentBase *env)
+{
+	if (_workStealingActive) {
+		_workStealingActive = false;
+		for (uintptr_t i = 0; i < _workStealingThreadCount; i++) {
+			flushDeque(env, &_deques[i]);
+		}
+		_workStealingThreadCount = 0;
+	}
+}
+
 /**
  * Transfer a packet to the current overflow handler to be emptied to
  * resolve work packet overflow. 
@@ -384,7 +509,20 @@ MM_WorkPackets::getInputPacketFromOverflow(MM_EnvironmentBase *env)
 MM_Packet *
 MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 {
-	MM_Packet *packet;
+	MM_Packet *packet = NULL;
+	MM_WorkStealingDeque *deque = getOwnerDeque(env);
+
+	/* packets this thread released most recently are the cheapest to get and the most likely to be cache-warm */
+	if (NULL != deque) {
+		packet = deque->pop();
+		if (NULL != packet) {
+			packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsAcquired += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			return packet;
+		}
+	}
 
 	if (!inputPacketAvailable(env)) {
 		return NULL;
@@ -404,6 +542,10 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 		}
 	}
 
+	if ((NULL == packet) && (NULL != deque)) {
+		packet = getPacketByStealing(env);
+	}
+
 	if(NULL == packet) {
 		packet = getInputPacketFromOverflow(env);
 	}
@@ -529,6 +671,12 @@ MM_WorkPackets::getOutputPacket(MM_EnvironmentBase *env)
 	if(NULL != outputPacket) {
 		return outputPacket;
 	}
+
+	/* Packets held on our work-stealing deque are invisible to the overflow handling - return them to the shared lists first */
+	MM_WorkStealingDeque *deque = getOwnerDeque(env);
+	if (NULL != deque) {
+		flushDeque(env, deque);
+	}
 	
 	/* Adding a block of packets failed so move on to overflow processing */
 	return getPacketByOverflowing(env);
@@ -762,7 +910,17 @@ MM_WorkPackets::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	env->_workPacketStats.workPacketsReleased += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
-	putPacket(env, packet);
+	MM_WorkStealingDeque *deque = getOwnerDeque(env);
+	if ((NULL != deque) && !packet->isEmpty() && deque->push(packet)) {
+		packet->resetOwner();
+		/* publish the packet before checking for waiting threads (they re-check the deques under the input list monitor) */
+		MM_AtomicOperations::sync();
+		if (_inputListWaitCount > 0) {
+			notifyWaitingThreads(env);
+		}
+	} else {
+		putPacket(env, packet);
+	}
 }
 
 /**
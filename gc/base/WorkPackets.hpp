@@ -38,6 +38,7 @@
 #include "Packet.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
+#include "WorkStealingDeque.hpp"
 
 class MM_EnvironmentBase;
 class MM_GCExtensionsBase;
@@ -89,10 +90,24 @@ protected:
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
+	MM_WorkStealingDeque *_deques; /**< Per-thread work-stealing deques (indexed by slave ID), or NULL if work stealing is disabled */
+	uintptr_t _dequeCount; /**< Number of entries in _deques */
+	volatile bool _workStealingActive; /**< True while a parallel mark task is using the deques */
+	uintptr_t _workStealingThreadCount; /**< Number of threads participating in the active work-stealing task */
+
 	void emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type);
 	virtual MM_Packet *getInputPacketFromOverflow(MM_EnvironmentBase *env);
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
 
+	/**
+	 * Return the work-stealing deque owned by the current thread.
+	 * @return the deque, or NULL if work stealing is not active for the thread
+	 */
+	MM_WorkStealingDeque *getOwnerDeque(MM_EnvironmentBase *env);
+	MM_Packet *getPacketByStealing(MM_EnvironmentBase *env);
+	bool dequedPacketAvailable();
+	void flushDeque(MM_EnvironmentBase *env, MM_WorkStealingDeque *deque);
+
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
 	MM_Packet *getLeastFullPacket(MM_EnvironmentBase *env, int requiredSlots);
 
@@ -116,6 +131,19 @@ public:
 	virtual MM_Packet *getOutputPacket(MM_EnvironmentBase *env);
 	void putPacket(MM_EnvironmentBase *env, MM_Packet *packet);
 	void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+
+	/**
+	 * Start keeping output packets on per-thread work-stealing deques (no-op unless enabled by workStealingMark).
+	 * Called by the master thread before the participating threads are dispatched.
+	 * @param threadCount number of threads participating in the task
+	 */
+	void startWorkStealing(MM_EnvironmentBase *env, uintptr_t threadCount);
+
+	/**
+	 * Stop using the work-stealing deques, returning any packets left on them to the shared lists.
+	 * Called by the master thread after all participating threads completed the task.
+	 */
+	void stopWorkStealing(MM_EnvironmentBase *env);
 	
 	MM_Packet *getDeferredPacket(MM_EnvironmentBase *env);
 	void putDeferredPacket(MM_EnvironmentBase *env, MM_Packet *packet);
@@ -199,7 +227,7 @@ public:
 	 */
 	void clearOverflowFlag();
 
-	void resetAllPackets(MM_EnvironmentBase *env);
+	virtual void resetAllPackets(MM_EnvironmentBase *env);
 	
 	void overflowItem(MM_EnvironmentBase *env, void *item, MM_OverflowType type);
 
@@ -235,7 +263,11 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
-		_overflowHandler(NULL)
+		_overflowHandler(NULL),
+		_deques(NULL),
+		_dequeCount(0),
+		_workStealingActive(false),
+		_workStealingThreadCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
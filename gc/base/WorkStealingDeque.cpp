@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Packet.hpp"
+#include "WorkStealingDeque.hpp"
+
+/**
+ * Allocate the entry buffer of the deque.
+ * @param capacity requested number of entries, rounded up to a power of two
+ * @return true on success, false otherwise
+ */
+bool
+MM_WorkStealingDeque::initialize(MM_EnvironmentBase *env, uintptr_t capacity)
+{
+	_capacity = 2;
+	while (_capacity < capacity) {
+		_capacity <<= 1;
+	}
+
+	_buffer = (MM_Packet * volatile *)env->getForge()->allocate(sizeof(MM_Packet *) * _capacity, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _buffer) {
+		return false;
+	}
+	_top = 0;
+	_bottom = 0;
+
+	return true;
+}
+
+void
+MM_WorkStealingDeque::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _buffer) {
+		env->getForge()->free((void *)_buffer);
+		_buffer = NULL;
+	}
+}
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+
+class MM_EnvironmentBase;
+class MM_Packet;
+
+/**
+ * Bounded Chase-Lev work-stealing deque of work packets.
+ * The owning thread pushes and pops at the bottom without locking; any other thread may steal from the top,
+ * racing only with other thieves (and with the owner for the last entry) on a single compare-and-swap.
+ * @ingroup GC_Base
+ */
+class MM_WorkStealingDeque : public MM_BaseNonVirtual
+{
+/* Data Section */
+public:
+protected:
+private:
+	volatile uintptr_t _top; /**< Index of the oldest entry; advanced by thieves (and by the owner when taking the last entry) */
+	uintptr_t _padding[7]; /**< Keep the owner and thief ends of the deque on separate cache lines */
+	volatile uintptr_t _bottom; /**< Index one past the newest entry; only written by the owning thread */
+	MM_Packet * volatile *_buffer; /**< Circular array of _capacity entries */
+	uintptr_t _capacity; /**< Number of entries in _buffer, a power of two */
+
+/* Functionality Section */
+public:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Push a packet at the bottom of the deque. Must only be called by the owning thread.
+	 * @param packet the packet to push
+	 * @return true on success, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_Packet *packet)
+	{
+		uintptr_t bottom = _bottom;
+		if ((bottom - _top) >= _capacity) {
+			return false;
+		}
+		_buffer[bottom & (_capacity - 1)] = packet;
+		/* the entry must be visible before the new bottom is published to thieves */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed packet. Must only be called by the owning thread.
+	 * @return the packet, or NULL if the deque is empty (or the last entry was stolen)
+	 */
+	MMINLINE MM_Packet *
+	pop()
+	{
+		uintptr_t bottom = _bottom;
+		if (bottom == _top) {
+			return NULL;
+		}
+		bottom -= 1;
+		_bottom = bottom;
+		/* the reservation of the bottom entry must be visible before top is sampled */
+		MM_AtomicOperations::sync();
+		uintptr_t top = _top;
+		MM_Packet *packet = NULL;
+		if ((intptr_t)(bottom - top) >= 0) {
+			packet = _buffer[bottom & (_capacity - 1)];
+			if (bottom == top) {
+				/* last entry - race any thieves for it */
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					packet = NULL;
+				}
+				_bottom = top + 1;
+			}
+		} else {
+			_bottom = top;
+		}
+		return packet;
+	}
+
+	/**
+	 * Steal the oldest packet. May be called by any thread.
+	 * @return the packet, or NULL if the deque was empty or the steal lost a race
+	 */
+	MMINLINE MM_Packet *
+	steal()
+	{
+		uintptr_t top = _top;
+		/* full fence: the owner's pop() stores _bottom then loads _top, so a read barrier is not enough here */
+		MM_AtomicOperations::sync();
+		uintptr_t bottom = _bottom;
+		MM_Packet *packet = NULL;
+		if ((intptr_t)(bottom - top) > 0) {
+			packet = _buffer[top & (_capacity - 1)];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				packet = NULL;
+			}
+		}
+		return packet;
+	}
+
+	/**
+	 * Racy emptiness check, suitable for deciding whether a steal is worth attempting.
+	 * @return true if the deque appears to hold no packets
+	 */
+	MMINLINE bool isEmpty() { return (intptr_t)(_bottom - _top) <= 0; }
+
+	MM_WorkStealingDeque()
+		: MM_BaseNonVirtual()
+		, _top(0)
+		, _bottom(0)
+		, _buffer(NULL)
+		, _capacity(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
@@ -136,7 +136,13 @@ bool
 MM_GlobalAllocationManagerSegregated::acquireAllocationContext(MM_EnvironmentBase *env)
 {
 	if (env->getAllocationContext() == NULL) {
-		uintptr_t allocationContextIndex = _nextAllocationContext++;
+		uintptr_t allocationContextIndex = 0;
+		intptr_t cpu = -1;
+		if (_extensions->segregatedAllocationContextPerCPU && (0 <= (cpu = omrthread_get_current_cpu()))) {
+			allocationContextIndex = (uintptr_t)cpu;
+		} else {
+			allocationContextIndex = _nextAllocationContext++;
+		}
 		allocationContextIndex %= _managedAllocationContextCount;
 		MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *)_managedAllocationContexts[allocationContextIndex];
 		if (NULL != ac) {
@@ -158,6 +164,21 @@ MM_GlobalAllocationManagerSegregated::releaseAllocationContext(MM_EnvironmentBas
 	}
 }
 
+void
+MM_GlobalAllocationManagerSegregated::rebindAllocationContextToCurrentCPU(MM_EnvironmentBase *env)
+{
+	MM_AllocationContextSegregated *currentContext = (MM_AllocationContextSegregated *) env->getAllocationContext();
+	intptr_t cpu = omrthread_get_current_cpu();
+	if ((NULL != currentContext) && (0 <= cpu)) {
+		MM_AllocationContextSegregated *cpuContext = (MM_AllocationContextSegregated *)_managedAllocationContexts[(uintptr_t)cpu % _managedAllocationContextCount];
+		if (cpuContext != currentContext) {
+			currentContext->exit(env);
+			cpuContext->enter(env);
+			env->setAllocationContext(cpuContext);
+		}
+	}
+}
+
 void
 MM_GlobalAllocationManagerSegregated::flushCachedFullRegions(MM_EnvironmentBase *env)
 {
@@ -76,6 +76,14 @@ public:
 
 	virtual bool acquireAllocationContext(MM_EnvironmentBase *env);
 	virtual void releaseAllocationContext(MM_EnvironmentBase *env);
+
+	/**
+	 * Move the thread to the allocation context of the CPU it is running on, if that is known and differs from
+	 * the context it holds. Threads sharing a CPU then refill from the same (warm) context, however short lived they are.
+	 * The CPU is only a hint: contexts are shared under their own locks, so being migrated before the refill
+	 * costs locality, not correctness.
+	 */
+	void rebindAllocationContextToCurrentCPU(MM_EnvironmentBase *env);
 	virtual void printAllocationContextStats(MM_EnvironmentBase *env, uintptr_t eventNum, J9HookInterface** hookInterface) { /* no impl */ }
 
 	/**
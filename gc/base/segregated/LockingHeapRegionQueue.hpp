@@ -142,6 +142,17 @@ public:
 		return region;
 	}
 
+	/* as dequeueIfNonEmpty, but give up rather than wait if another thread holds the receiver's lock */
+	MM_HeapRegionDescriptorSegregated *dequeueIfNonEmptyNoWait()
+	{
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		if ((0 != _length) && tryLock()) {
+			region = dequeueInternal();
+			unlock();
+		}
+		return region;
+	}
+
 	virtual uintptr_t dequeue(MM_HeapRegionQueue *targetAsPQ, uintptr_t count)
 	{
 		MM_LockingHeapRegionQueue* target = MM_LockingHeapRegionQueue::asLockingHeapRegionQueue(targetAsPQ);
@@ -168,6 +179,9 @@ private:
 			omrthread_monitor_enter(_lockMonitor);
 		}
 	}
+	MMINLINE bool tryLock() {
+		return !_needLock || (0 == omrthread_monitor_try_enter(_lockMonitor));
+	}
 	MMINLINE void unlock() {
 		if (_needLock) {
 			omrthread_monitor_exit(_lockMonitor);
@@ -295,19 +295,21 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 {
 	MM_HeapRegionDescriptorSegregated *region = NULL;
 
-	if (numRegions == 1) {
-		region = _singleFreeList->allocate(env, szClass);
-	}
-	
-	if (region == NULL) {
-		region = _multiFreeList->allocate(env, szClass, numRegions, maxExcess);
-		
+	do {
+		if (numRegions == 1) {
+			region = _singleFreeList->allocate(env, szClass);
+		}
+
 		if (region == NULL) {
-			region = _coalesceFreeList->allocate(env, szClass, numRegions, maxExcess);
+			region = _multiFreeList->allocate(env, szClass, numRegions, maxExcess);
+
+			if (region == NULL) {
+				region = _coalesceFreeList->allocate(env, szClass, numRegions, maxExcess);
+			}
 		}
-	}
-	
-	
+		/* Empty regions may still be waiting for a lazy sweep; recover them before reporting failure */
+	} while ((region == NULL) && env->getExtensions()->lazySweepSegregated && sweepPendingSmallRegions(env));
+
 	if (region != NULL) {
 		incrementRegionsInUse(region->getRange()); /* we must add here because we will return remainder later */
 		
@@ -321,6 +323,19 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 	return region;
 }
 
+uintptr_t
+MM_RegionPoolSegregated::getAllocationSplitIndex(MM_EnvironmentBase *env)
+{
+	uintptr_t index = env->getEnvironmentId();
+	if (env->getExtensions()->segregatedAllocationContextPerCPU) {
+		intptr_t cpu = omrthread_get_current_cpu();
+		if (0 <= cpu) {
+			index = (uintptr_t)cpu;
+		}
+	}
+	return index % _splitAvailableListSplitCount;
+}
+
 /* join the lists for each buckets per size class, per split index */
 void
 MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
@@ -348,9 +363,22 @@ MM_RegionPoolSegregated::allocateRegionFromSmallSizeClass(MM_EnvironmentBase *en
 	}
 
 	/* try bucket 0, i.e. primary bucket first */
-	uintptr_t startList = env->getEnvironmentId() % _splitAvailableListSplitCount;
+	uintptr_t startList = getAllocationSplitIndex(env);
 	MM_LockingHeapRegionQueue *primaryQueueArray = _smallAvailableRegions[sizeClass][PRIMARY_BUCKET];
-	MM_LockingHeapRegionQueue *allocationQueue = &primaryQueueArray[startList];
+	MM_LockingHeapRegionQueue *allocationQueue = NULL;
+
+	/* with per CPU allocation contexts, take a region from any uncontended split queue before waiting on one, so that refilling threads spread over the queues */
+	if (env->getExtensions()->segregatedAllocationContextPerCPU) {
+		for (uintptr_t j=startList; j<startList+_splitAvailableListSplitCount; j++) {
+			allocationQueue = &primaryQueueArray[j%_splitAvailableListSplitCount];
+			region = allocationQueue->dequeueIfNonEmptyNoWait();
+			if (region != NULL) {
+				return region;
+			}
+		}
+	}
+
+	allocationQueue = &primaryQueueArray[startList];
 	region = allocationQueue->dequeueIfNonEmpty();
 	if (region != NULL) {
 		return region;
@@ -417,6 +445,66 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 	return region;
 }
 
+bool
+MM_RegionPoolSegregated::sweepPendingSmallRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t splitIndex)
+{
+	_sweepScheme->sweepRegion(env, region);
+	decrementCurrentCountOfSweepRegions(sizeClass, 1);
+	decrementCurrentTotalCountOfSweepRegions(1);
+
+	MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
+	uintptr_t numCells = region->getNumCells();
+	if (memoryPoolACL->getFreeCount() == numCells) {
+		region->emptyRegionReturned(env);
+		addFreeRegion(env, region);
+		return true;
+	}
+
+	uintptr_t occupancy = (memoryPoolACL->getMarkCount() * 100) / numCells;
+	/* Keep maintaining the occupancy info while the pause leaves small regions to allocation */
+	updateOccupancy(sizeClass, occupancy);
+	if (memoryPoolACL->getMarkCount() == numCells) {
+		_smallFullRegions[sizeClass]->enqueue(region);
+	} else {
+		enqueueAvailable(region, sizeClass, occupancy, splitIndex);
+		_skipAvailableRegionForAllocation[sizeClass] = 0;
+	}
+	return false;
+}
+
+bool
+MM_RegionPoolSegregated::sweepPendingSmallRegions(MM_EnvironmentBase *env)
+{
+	uintptr_t splitIndex = getAllocationSplitIndex(env);
+	bool regionFreed = false;
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; !regionFreed && (sizeClass <= OMR_SIZECLASSES_MAX_SMALL); sizeClass++) {
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (!regionFreed && (NULL != (region = _smallSweepRegions[sizeClass]->dequeue()))) {
+			regionFreed = sweepPendingSmallRegion(env, region, sizeClass, splitIndex);
+		}
+	}
+
+	return regionFreed;
+}
+
+uintptr_t
+MM_RegionPoolSegregated::completeLazySweep(MM_EnvironmentBase *env)
+{
+	uintptr_t splitIndex = getAllocationSplitIndex(env);
+	uintptr_t sweptRegions = 0;
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (NULL != (region = _smallSweepRegions[sizeClass]->dequeue())) {
+			sweepPendingSmallRegion(env, region, sizeClass, splitIndex);
+			sweptRegions += 1;
+		}
+	}
+
+	return sweptRegions;
+}
+
 void
 MM_RegionPoolSegregated::updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy)
 {
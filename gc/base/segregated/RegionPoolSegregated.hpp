@@ -157,6 +157,18 @@ private:
 	{
 		MM_AtomicOperations::subtract(&_regionsInUse, value);
 	}
+
+	/**
+	 * Index of the split available list a mutator allocates from (and returns lazily swept regions to):
+	 * the one of its current CPU if segregatedAllocationContextPerCPU is set, otherwise the one of its environment.
+	 */
+	uintptr_t getAllocationSplitIndex(MM_EnvironmentBase *env);
+
+	/**
+	 * Sweep a small region that a lazy sweep left pending and file it as free, full or available.
+	 * @return true if the region was empty and has been returned to the free lists
+	 */
+	bool sweepPendingSmallRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t splitIndex);
 	
 protected:
 public:
@@ -174,6 +186,18 @@ public:
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromArrayletSizeClass(MM_EnvironmentBase *env);
 	MM_HeapRegionDescriptorSegregated *sweepAndAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
+	/**
+	 * Sweep small regions left unswept by a lazy sweep, across all size classes, until at least one
+	 * region has been returned to the free lists. Partially used regions become available for their size class.
+	 * @return true if a region was freed
+	 */
+	bool sweepPendingSmallRegions(MM_EnvironmentBase *env);
+	/**
+	 * Sweep every small region still left unswept by a lazy sweep. Must run before the next mark
+	 * rebuilds the mark map these regions are swept against.
+	 * @return the number of regions swept
+	 */
+	uintptr_t completeLazySweep(MM_EnvironmentBase *env);
 	void enqueueAvailable(MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t occupancy, uintptr_t splitListIndex);
 
 	/**
@@ -30,6 +30,7 @@
 #include "EnvironmentBase.hpp"
 #include "FrequentObjectsStats.hpp"
 #include "GCExtensionsBase.hpp"
+#include "GlobalAllocationManagerSegregated.hpp"
 #include "Heap.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -92,6 +93,8 @@ MM_SegregatedAllocationInterface::initialize(MM_EnvironmentBase *env)
 		_allocationCache = _languageAllocationCache.getLanguageSegregatedAllocationCacheStruct(env);
 		_sizeClasses = extensions->defaultSizeClasses;
 		_cachedAllocationsEnabled = true;
+		_sizeSamplingInterval = extensions->sizeClassSamplingInterval;
+		_sizeSamplingCountdown = _sizeSamplingInterval;
 
 		memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
 		memset(&_allocationCacheStats, 0, sizeof(_allocationCacheStats));
@@ -142,6 +145,22 @@ MM_SegregatedAllocationInterface::allocateFromCache(MM_EnvironmentBase* env, uin
 	return cellCurrent;
 }
 
+void*
+MM_SegregatedAllocationInterface::preAllocateSmall(MM_EnvironmentBase *env, uintptr_t sizeInBytes)
+{
+	void *cell = NULL;
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->segregatedAllocationContextPerCPU) {
+		((MM_GlobalAllocationManagerSegregated *)extensions->globalAllocationManager)->rebindAllocationContextToCurrentCPU(env);
+	}
+
+	MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
+	if (ac != NULL) {
+		cell = ac->preAllocateSmall(env, sizeInBytes);
+	}
+	return cell;
+}
+
 void*
 MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure)
 {
@@ -155,12 +174,10 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 		
 		/* Ensure we're allocating from the heap (not immortal or scopes) and that the allocation will be from a small region. */
 		if (memorySpace == env->getExtensions()->heap->getDefaultMemorySpace() && (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES)) {
+			sampleAllocationSize(sizeInBytes);
 			cell = allocateFromCache(env, sizeInBytes);
 			if (NULL == cell) {
-				MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
-				if (ac != NULL) {
-					cell = ac->preAllocateSmall(env, sizeInBytes);
-				}
+				cell = preAllocateSmall(env, sizeInBytes);
 			}
 		}
 		
@@ -173,12 +190,10 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 		if (memorySpace != env->getExtensions()->heap->getDefaultMemorySpace()) {
 			cell = memorySpace->getDefaultMemorySubSpace()->allocateObject(env, allocateDescription, NULL, NULL, shouldCollectOnFailure);
 		} else if (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES) {
+			sampleAllocationSize(sizeInBytes);
 			cell = allocateFromCache(env, sizeInBytes);
 			if (NULL == cell) {
-				MM_AllocationContextSegregated *ac = (MM_AllocationContextSegregated *) env->getAllocationContext();
-				if (ac != NULL) {
-					cell = ac->preAllocateSmall(env, sizeInBytes);
-				}
+				cell = preAllocateSmall(env, sizeInBytes);
 			}
 		}
 	}
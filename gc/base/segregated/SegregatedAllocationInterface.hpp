@@ -29,6 +29,7 @@
 #include "LanguageSegregatedAllocationCache.hpp"
 
 #include "ObjectAllocationInterface.hpp"
+#include "SizeClasses.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -56,6 +57,8 @@ private:
 	MM_SizeClasses* _sizeClasses; /**< The size classes used to map byte sizes to size class indexes. */
 	
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
+	uintptr_t _sizeSamplingInterval; /**< Sample the size of one in this many small allocations (0 if not sampling) */
+	uintptr_t _sizeSamplingCountdown; /**< Small allocations left until the next size sample */
 	
 	uintptr_t *_allocationCacheBases[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The Base of each current cache (per size class). */
 
@@ -102,7 +105,9 @@ protected:
 	MM_SegregatedAllocationInterface(MM_EnvironmentBase *env) :
 		MM_ObjectAllocationInterface(env),
 		_sizeClasses(NULL),
-		_cachedAllocationsEnabled(true)
+		_cachedAllocationsEnabled(true),
+		_sizeSamplingInterval(0),
+		_sizeSamplingCountdown(0)
 	{
 		_typeId = __FUNCTION__;
 		memset(_allocationCacheBases, 0, sizeof(_allocationCacheBases));
@@ -110,6 +115,23 @@ protected:
 	
 private:
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
+	/**
+	 * Record the size of every _sizeSamplingInterval'th small allocation of the thread in the size classes' histogram.
+	 */
+	MMINLINE void sampleAllocationSize(uintptr_t sizeInBytes)
+	{
+		if ((0 != _sizeSamplingInterval) && (0 == --_sizeSamplingCountdown)) {
+			_sizeSamplingCountdown = _sizeSamplingInterval;
+			_sizeClasses->recordSizeSample(sizeInBytes);
+		}
+	}
+
+	/**
+	 * Allocate small cells into the cache from the allocation context, first moving the thread to the
+	 * context of its current CPU if so configured.
+	 */
+	void *preAllocateSmall(MM_EnvironmentBase *env, uintptr_t sizeInBytes);
 	
 };
 
@@ -29,6 +29,7 @@
 #include "MarkMap.hpp"
 #include "modronapicore.hpp"
 #include "MemoryPoolSegregated.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "ParallelMarkTask.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
@@ -190,6 +191,16 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	MM_MarkStats *markStats = &_extensions->globalGCStats.markStats;
 
+	MM_RegionPoolSegregated *regionPool = ((MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool())->getRegionPool();
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+	if (_extensions->lazySweepSegregated) {
+		/* Small regions the last cycle left unswept are swept against its mark map before marking rebuilds it.
+		 * This must precede the flush below, which puts the contexts' full regions on the same sweep lists.
+		 */
+		sweepStats->lazySweepCompletedRegions = regionPool->completeLazySweep(env);
+		sweepStats->lazySweepAllocationSweptRegions = _lazySweepPendingRegions - sweepStats->lazySweepCompletedRegions;
+	}
+
 	/* OMRTODO the allocation contexts are never flushed for realtime, do
 	 * we really need to do this here? */
 	/* Flush the allocation contexts */
@@ -224,11 +235,14 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	/*
 	 * Sweeping
 	 */
-	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
 	reportSweepStart(env);
 	sweepStats->_startTime = omrtime_hires_clock();
 	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool());
 	_dispatcher->run(env, &sweepTask);
+	if (_extensions->lazySweepSegregated) {
+		_lazySweepPendingRegions = regionPool->getCurrentTotalCountOfSweepRegions();
+		sweepStats->lazySweepPendingRegions = _lazySweepPendingRegions;
+	}
 	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
 	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
 	/* We now have accurate free space statistics so recalculate any expand/contract amount */
@@ -48,6 +48,7 @@ protected:
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
+	uintptr_t _lazySweepPendingRegions; /**< Number of small regions the last lazy sweep left for allocation to sweep */
 private:
 public:
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
@@ -120,6 +121,7 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _lazySweepPendingRegions(0)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
@@ -21,7 +21,15 @@
  *******************************************************************************/
 #include "SizeClasses.hpp"
 
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "omrport.h"
+#include "ut_j9mm.h"
+
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -57,11 +65,25 @@ bool
 MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 {
 	OMR_SizeClasses* sizeClasses = env->getOmrVM()->_sizeClasses;
+	const char *profile = env->getExtensions()->sizeClassProfile;
 	_smallCellSizes = sizeClasses->smallCellSizes;
 	_smallNumCells = sizeClasses->smallNumCells;
 	_sizeClassIndex = sizeClasses->sizeClassIndex;
+	memset((void *)_sizeSamples, 0, sizeof(_sizeSamples));
 	
 	memcpy(_smallCellSizes, initialCellSizes, sizeof(initialCellSizes));
+	if (NULL != profile) {
+		switch (readProfile(env->getPortLibrary(), profile, _smallCellSizes)) {
+		case profileLoaded:
+			Trc_MM_SizeClasses_loadProfile(env->getLanguageVMThread(), profile, _smallCellSizes[OMR_SIZECLASSES_MIN_SMALL], _smallCellSizes[OMR_SIZECLASSES_MAX_SMALL]);
+			break;
+		case profileInvalid:
+			Trc_MM_SizeClasses_loadProfile_invalid(env->getLanguageVMThread(), profile);
+			break;
+		default:
+			break;
+		}
+	}
 	
 	_sizeClassIndex[0] = 0;
 	_smallNumCells[0] = 0;
@@ -79,7 +101,190 @@ MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 void
 MM_SizeClasses::tearDown(MM_EnvironmentBase *envModron)
 {
-	
+	MM_GCExtensionsBase *extensions = envModron->getExtensions();
+	if ((NULL != extensions->sizeClassProfile) && (0 != extensions->sizeClassSamplingInterval)) {
+		storeProfile(envModron, extensions->sizeClassProfile);
+	}
+}
+
+uintptr_t
+MM_SizeClasses::computeTunedCellSizes(MM_EnvironmentBase *env, uintptr_t *cellSizes, uint64_t *currentWaste, uint64_t *tunedWaste)
+{
+	uintptr_t sampleCount = 0;
+	uint64_t *waste = (uint64_t *)env->getForge()->allocate(OMR_SIZECLASSES_TUNING_ENTRIES * sizeof(uint64_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	uint16_t *lower = (uint16_t *)env->getForge()->allocate(OMR_SIZECLASSES_TUNING_ENTRIES * sizeof(uint16_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+
+	if ((NULL != waste) && (NULL != lower)) {
+		sampleCount = tuneCellSizes(_sizeSamples, _smallCellSizes, cellSizes, currentWaste, tunedWaste, waste, lower);
+	}
+
+	if (NULL != waste) {
+		env->getForge()->free(waste);
+	}
+	if (NULL != lower) {
+		env->getForge()->free(lower);
+	}
+	return sampleCount;
+}
+
+uintptr_t
+MM_SizeClasses::tuneCellSizes(const volatile uintptr_t *sizeSamples, const uintptr_t *currentCellSizes, uintptr_t *cellSizes, uint64_t *currentWaste, uint64_t *tunedWaste, uint64_t *waste, uint16_t *lower)
+{
+	const uintptr_t granules = OMR_SIZECLASSES_SAMPLE_GRANULES;
+	const uintptr_t minGranules = ((uintptr_t)1 << OMR_SIZECLASSES_LOG_SMALLEST) / OMR_SIZECLASSES_SAMPLE_GRANULE;
+	const uint64_t noSolution = (uint64_t)-1;
+
+	/* Prefix sums of the samples, and of the samples weighted by their size, so that the bytes lost by a size class
+	 * are found in constant time: a class of cellSize granules serving sizes (low, cellSize] loses
+	 * cellSize * (counts[cellSize] - counts[low]) - (weighted[cellSize] - weighted[low]) granules.
+	 */
+	uint64_t counts[granules + 1];
+	uint64_t weighted[granules + 1];
+	counts[0] = 0;
+	weighted[0] = 0;
+	*currentWaste = 0;
+	uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL;
+	for (uintptr_t size = 1; size <= granules; size++) {
+		uint64_t samples = sizeSamples[size];
+		counts[size] = counts[size - 1] + samples;
+		weighted[size] = weighted[size - 1] + (samples * size);
+		while (currentCellSizes[sizeClass] < (size * OMR_SIZECLASSES_SAMPLE_GRANULE)) {
+			sizeClass += 1;
+		}
+		*currentWaste += samples * (currentCellSizes[sizeClass] - (size * OMR_SIZECLASSES_SAMPLE_GRANULE));
+	}
+	uintptr_t sampleCount = (uintptr_t)counts[granules];
+	if (0 == sampleCount) {
+		return 0;
+	}
+
+	/* waste[k][s] is the least loss serving sizes up to s with k classes, the largest of which is s granules;
+	 * lower[k][s] is the size of the class below it in that solution.
+	 */
+	for (uintptr_t size = 0; size <= granules; size++) {
+		waste[size] = (0 == size) ? 0 : noSolution;
+	}
+	for (uintptr_t classes = 1; classes <= OMR_SIZECLASSES_NUM_SMALL; classes++) {
+		uint64_t *classWaste = &waste[classes * (granules + 1)];
+		uint64_t *previousWaste = &waste[(classes - 1) * (granules + 1)];
+		uint16_t *classLower = &lower[classes * (granules + 1)];
+		for (uintptr_t size = 0; size <= granules; size++) {
+			classWaste[size] = noSolution;
+			classLower[size] = 0;
+			if (size < minGranules) {
+				continue;
+			}
+			for (uintptr_t low = 0; low < size; low++) {
+				if (noSolution != previousWaste[low]) {
+					uint64_t candidate = previousWaste[low] + (size * (counts[size] - counts[low])) - (weighted[size] - weighted[low]);
+					if (candidate < classWaste[size]) {
+						classWaste[size] = candidate;
+						classLower[size] = (uint16_t)low;
+					}
+				}
+			}
+		}
+	}
+
+	/* The largest class must stay the largest small size */
+	*tunedWaste = waste[(OMR_SIZECLASSES_NUM_SMALL * (granules + 1)) + granules] * OMR_SIZECLASSES_SAMPLE_GRANULE;
+	cellSizes[0] = 0;
+	uintptr_t size = granules;
+	for (uintptr_t classes = OMR_SIZECLASSES_NUM_SMALL; classes >= OMR_SIZECLASSES_MIN_SMALL; classes--) {
+		cellSizes[classes] = size * OMR_SIZECLASSES_SAMPLE_GRANULE;
+		size = lower[(classes * (granules + 1)) + size];
+	}
+	return sampleCount;
+}
+
+MM_SizeClasses::ProfileState
+MM_SizeClasses::readProfile(OMRPortLibrary *portLibrary, const char *fileName, uintptr_t *cellSizes)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	ProfileState state = profileMissing;
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+
+	if (-1 != fd) {
+		char buffer[1024];
+		intptr_t bytesRead = omrfile_read(fd, buffer, sizeof(buffer) - 1);
+		omrfile_close(fd);
+
+		if (0 < bytesRead) {
+			uintptr_t profileSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+			uintptr_t count = 0;
+			char *cursor = buffer;
+			bool result = true;
+			buffer[bytesRead] = '\0';
+			profileSizes[0] = 0;
+
+			while (result && ('\0' != *cursor)) {
+				if ('#' == *cursor) {
+					/* comment line */
+					while (('\0' != *cursor) && ('\n' != *cursor)) {
+						cursor += 1;
+					}
+				} else if (isspace((unsigned char)*cursor)) {
+					cursor += 1;
+				} else {
+					char *end = NULL;
+					uintptr_t cellSize = (uintptr_t)strtoul(cursor, &end, 10);
+					/* cell sizes must be increasing multiples of the granule, and at least the smallest class size */
+					if ((end == cursor) || (OMR_SIZECLASSES_NUM_SMALL <= count) || (0 != (cellSize % OMR_SIZECLASSES_SAMPLE_GRANULE))
+						|| (cellSize < ((uintptr_t)1 << OMR_SIZECLASSES_LOG_SMALLEST)) || (cellSize <= profileSizes[count])
+					) {
+						result = false;
+					} else {
+						count += 1;
+						profileSizes[count] = cellSize;
+						cursor = end;
+					}
+				}
+			}
+
+			/* every small size must map to a class */
+			result = result && (OMR_SIZECLASSES_NUM_SMALL == count) && (OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES == profileSizes[OMR_SIZECLASSES_MAX_SMALL]);
+			if (result) {
+				memcpy(cellSizes, profileSizes, sizeof(profileSizes));
+				state = profileLoaded;
+			} else {
+				state = profileInvalid;
+			}
+		}
+	}
+
+	return state;
+}
+
+bool
+MM_SizeClasses::writeProfile(OMRPortLibrary *portLibrary, const char *fileName, const uintptr_t *cellSizes, uintptr_t sampleCount, uint64_t currentWaste, uint64_t tunedWaste)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+
+	if (-1 != fd) {
+		omrfile_printf(fd, "# Segregated heap cell sizes (bytes) for size classes %zu to %zu, tuned from %zu sampled allocations\n",
+			(uintptr_t)OMR_SIZECLASSES_MIN_SMALL, (uintptr_t)OMR_SIZECLASSES_MAX_SMALL, sampleCount);
+		omrfile_printf(fd, "# Bytes lost to rounding by the samples: %llu with the cell sizes in use, %llu with these\n", currentWaste, tunedWaste);
+		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+			omrfile_printf(fd, "%zu\n", cellSizes[sizeClass]);
+		}
+		omrfile_close(fd);
+	}
+	return (-1 != fd);
+}
+
+void
+MM_SizeClasses::storeProfile(MM_EnvironmentBase *env, const char *fileName)
+{
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	uint64_t currentWaste = 0;
+	uint64_t tunedWaste = 0;
+	uintptr_t sampleCount = computeTunedCellSizes(env, cellSizes, &currentWaste, &tunedWaste);
+
+	if (0 != sampleCount) {
+		bool written = writeProfile(env->getPortLibrary(), fileName, cellSizes, sampleCount, currentWaste, tunedWaste);
+		Trc_MM_SizeClasses_storeProfile(env->getLanguageVMThread(), fileName, sampleCount, currentWaste, tunedWaste, written ? "true" : "false");
+	}
 }
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -24,24 +24,41 @@
 
 #include "omrcfg.h"
 #include "modronbase.h"
+#include "omrport.h"
 #include "sizeclasses.h"
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
 #include "Debug.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+/* Granularity (in bytes) of the sampled allocation sizes, and of the cell sizes of tuned size classes */
+#define OMR_SIZECLASSES_SAMPLE_GRANULE 8
+#define OMR_SIZECLASSES_SAMPLE_GRANULES (OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES / OMR_SIZECLASSES_SAMPLE_GRANULE)
+/* Number of entries of each of the scratch tables used to tune the cell sizes */
+#define OMR_SIZECLASSES_TUNING_ENTRIES ((OMR_SIZECLASSES_NUM_SMALL + 1) * (OMR_SIZECLASSES_SAMPLE_GRANULES + 1))
+
 class MM_EnvironmentBase;
 
 class MM_SizeClasses : public MM_BaseVirtual
 {
 /* Data members & types */
 public:
+	/**
+	 * Outcome of reading a size class profile file.
+	 */
+	enum ProfileState {
+		profileMissing = 0, /**< the file could not be read */
+		profileInvalid, /**< the file does not hold a valid set of cell sizes */
+		profileLoaded /**< the cell sizes were read from the file */
+	};
 protected:
 private:
 	uintptr_t* _smallCellSizes; /**< Array mapping size classes to the cell size of that size class. The array actually lives in the J9JavaVM. */
 	uintptr_t* _smallNumCells; /**< Array mapping size classes to the number of cells on a region of that size class. The array actually lives in the J9JavaVM. */
 	uintptr_t* _sizeClassIndex; /**< maps size request to size classes. The array actually lives in the OMR vm. */
+	volatile uintptr_t _sizeSamples[OMR_SIZECLASSES_SAMPLE_GRANULES + 1]; /**< Number of sampled small allocations, indexed by size in granules (rounded up) */
 	
 /* Methods */
 public:
@@ -72,7 +89,58 @@ public:
 		}
 		return _sizeClassIndex[sizeInBytes / sizeof(uintptr_t)];
 	}
-	
+
+	/**
+	 * Record the size of a sampled small allocation, for tuning the size classes.
+	 * @see MM_GCExtensionsBase::sizeClassSamplingInterval
+	 */
+	MMINLINE void recordSizeSample(uintptr_t sizeInBytes)
+	{
+		assume(sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES, "recordSizeSample: not a small size");
+		MM_AtomicOperations::add(&_sizeSamples[(sizeInBytes + OMR_SIZECLASSES_SAMPLE_GRANULE - 1) / OMR_SIZECLASSES_SAMPLE_GRANULE], 1);
+	}
+
+	/**
+	 * Compute the cell sizes which minimize the bytes lost to rounding sampled allocations up to their cell size.
+	 * The largest cell size stays OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES, so that every small size still maps to a class.
+	 * @param[out] cellSizes the tuned cell sizes, indexed by size class
+	 * @param[out] currentWaste bytes the sampled allocations lose to rounding with the current cell sizes
+	 * @param[out] tunedWaste bytes the sampled allocations lose to rounding with the tuned cell sizes
+	 * @return the number of samples the cell sizes were tuned from (0 if there were none or memory ran out)
+	 */
+	uintptr_t computeTunedCellSizes(MM_EnvironmentBase *env, uintptr_t *cellSizes, uint64_t *currentWaste, uint64_t *tunedWaste);
+
+	/**
+	 * Compute the tuned cell sizes from a histogram of sampled allocation sizes.
+	 * Kept apart from the instance so the tuning can be exercised without a heap.
+	 * @param[in] sizeSamples number of samples, indexed by size in granules, OMR_SIZECLASSES_SAMPLE_GRANULES + 1 entries
+	 * @param[in] currentCellSizes the cell sizes in use, indexed by size class
+	 * @param[out] cellSizes the tuned cell sizes, indexed by size class
+	 * @param[out] currentWaste bytes the sampled allocations lose to rounding with currentCellSizes
+	 * @param[out] tunedWaste bytes the sampled allocations lose to rounding with the tuned cell sizes
+	 * @param[in] waste scratch table of OMR_SIZECLASSES_TUNING_ENTRIES entries
+	 * @param[in] lower scratch table of OMR_SIZECLASSES_TUNING_ENTRIES entries
+	 * @return the number of samples the cell sizes were tuned from (0 if there were none, cellSizes is then left untouched)
+	 */
+	static uintptr_t tuneCellSizes(const volatile uintptr_t *sizeSamples, const uintptr_t *currentCellSizes, uintptr_t *cellSizes, uint64_t *currentWaste, uint64_t *tunedWaste, uint64_t *waste, uint16_t *lower);
+
+	/**
+	 * Read the cell sizes from a size class profile file.
+	 * @param[out] cellSizes the cell sizes read, indexed by size class, only written if the profile is loaded
+	 * @return whether the file was missing, invalid or loaded
+	 */
+	static ProfileState readProfile(OMRPortLibrary *portLibrary, const char *fileName, uintptr_t *cellSizes);
+
+	/**
+	 * Write cell sizes to a size class profile file, in the form readProfile() reads.
+	 * @param[in] cellSizes the cell sizes to write, indexed by size class
+	 * @param[in] sampleCount number of samples the cell sizes were tuned from
+	 * @param[in] currentWaste bytes the samples lose to rounding with the cell sizes in use
+	 * @param[in] tunedWaste bytes the samples lose to rounding with cellSizes
+	 * @return true if the file was written
+	 */
+	static bool writeProfile(OMRPortLibrary *portLibrary, const char *fileName, const uintptr_t *cellSizes, uintptr_t sampleCount, uint64_t currentWaste, uint64_t tunedWaste);
+
 protected:
 	bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
@@ -82,6 +150,11 @@ protected:
 	};
 	
 private:
+	/**
+	 * Tune the cell sizes to the sampled allocations and write them to the size class profile file,
+	 * to be applied at next startup.
+	 */
+	void storeProfile(MM_EnvironmentBase *env, const char *fileName);
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -24,6 +24,7 @@
 #include "sizeclasses.h"
 #include "ModronAssertions.h"
 
+#include "Bits.hpp"
 #include "EnvironmentBase.hpp"
 #include "FreeHeapRegionList.hpp"
 #include "GCExtensionsBase.hpp"
@@ -79,6 +80,15 @@ MM_SweepSchemeSegregated::kill(MM_EnvironmentBase *env)
 bool
 MM_SweepSchemeSegregated::initialize(MM_EnvironmentBase *env)
 {
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* Lazily swept regions must be finished before the next mark rebuilds the mark map, which only a
+	 * stop-the-world mark allows; an incremental (metronome) mark runs while mutators are still sweeping.
+	 */
+	if (extensions->lazySweepSegregated && extensions->isMetronomeGC()) {
+		return false;
+	}
+
 	return true;
 }
 
@@ -118,7 +128,14 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
-	incrementalSweepSmall(env);
+	/* A lazy sweep leaves the small regions on the sweep lists, from which allocation never hands out cells.
+	 * They are swept on allocation demand (see sweepAndAllocateRegionFromSmallSizeClass() and
+	 * sweepPendingSmallRegions()). Regions still unswept when the next cycle starts are swept against
+	 * this cycle's mark map before that cycle marks (see MM_RegionPoolSegregated::completeLazySweep()).
+	 */
+	if (_isFixHeapForWalk || !_extensions->lazySweepSegregated) {
+		incrementalSweepSmall(env);
+	}
 	regionPool->joinBucketListsForSplitIndex(env);
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
@@ -226,6 +243,22 @@ MM_SweepSchemeSegregated::sweepSmallRegion(MM_EnvironmentBase *env, MM_HeapRegio
 
 	_markMap->getSlotIndexAndMask((omrobjectptr_t)lastCellAddress, &lastCellSlotIndex, &lastCellBitMask);
 
+	/* Outside of metronome, which also sets scan bits, the bits set in a region's mark map are its live cells,
+	 * so counting them gives the live bytes of the region (live cells times the cell size) without walking the
+	 * cells. A fully live region has no free cells to link.
+	 * Regions are a whole number of mark map slots, so no slot counted here holds bits of another region.
+	 */
+	if (!_extensions->isMetronomeGC()) {
+		uintptr_t firstCellSlotIndex, firstCellBitMask;
+		_markMap->getSlotIndexAndMask((omrobjectptr_t)lowAddress, &firstCellSlotIndex, &firstCellBitMask);
+		uintptr_t *heapMapBits = _markMap->getHeapMapBits();
+		if (numCells == MM_Bits::populationCount(heapMapBits + firstCellSlotIndex, heapMapBits + lastCellSlotIndex + 1)) {
+			memoryPoolACL->setMarkCount(numCells);
+			memoryPoolACL->resetCurrentEntry();
+			return;
+		}
+	}
+
 	for (uintptr_t currentCellAddress = (uintptr_t)lowAddress; currentCellAddress <= lastCellAddress; currentCellAddress += blockSizeInBytes) {
 		uintptr_t initialSlotIndex, slotIndex, bitMask;
 
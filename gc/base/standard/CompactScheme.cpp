@@ -34,6 +34,7 @@
 #include "CollectorLanguageInterface.hpp"
 #include "CompactFixHeapForWalkTask.hpp"
 #include "CompactSchemeFixupObject.hpp"
+#include "CompactWindow.hpp"
 #include "Debug.hpp"
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
@@ -494,13 +495,103 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 					_compactTo = (_compactTo > _subAreaTable[j].firstObject) ? _compactTo : _subAreaTable[j].firstObject;
 				}
 				_subAreaTable[j].freeChunk = 0;
+				_subAreaTable[j].fragmentedBytes = 0;
 				j++;
 			}
 		}
+
+		if (_incrementalCycle) {
+			selectIncrementalWindow(env, j);
+		}
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 }
 
+/**
+ *  Restrict evacuation to the most fragmented window of sub areas.
+ */
+void
+MM_CompactScheme::selectIncrementalWindow(MM_EnvironmentStandard *env, uintptr_t subAreaCount)
+{
+	/* Free entries too small to hold a maximum sized TLH are the fragments compaction is meant to recover */
+	uintptr_t fragmentThreshold = _extensions->tlhMaximumSize;
+	uintptr_t evacuateCandidates = 0;
+
+	/* The sweep free lists are still intact here: charge each small free entry to its sub area.
+	 * Runs of sub areas sharing a pool are handled together so each pool list is walked once per run.
+	 */
+	uintptr_t runStart = 0;
+	while (runStart < subAreaCount) {
+		if (SubAreaEntry::init != _subAreaTable[runStart].state) {
+			runStart += 1;
+			continue;
+		}
+		MM_MemoryPool *memoryPool = _subAreaTable[runStart].memoryPool;
+		uintptr_t runEnd = runStart + 1;
+		while ((runEnd < subAreaCount) && (SubAreaEntry::init == _subAreaTable[runEnd].state) && (memoryPool == _subAreaTable[runEnd].memoryPool)) {
+			runEnd += 1;
+		}
+		evacuateCandidates += runEnd - runStart;
+
+		void *runLow = (void *)_subAreaTable[runStart].firstObject;
+		void *runHigh = (void *)_subAreaTable[runEnd].firstObject;
+		void *freeEntry = memoryPool->getFirstFreeStartingAddr(env);
+		while (NULL != freeEntry) {
+			uintptr_t freeSize = ((MM_HeapLinkedFreeHeader *)freeEntry)->getSize();
+			if ((freeEntry >= runLow) && (freeEntry < runHigh) && (freeSize < fragmentThreshold)) {
+				/* find the last sub area of the run starting at or below the entry */
+				uintptr_t low = runStart;
+				uintptr_t high = runEnd;
+				while ((high - low) > 1) {
+					uintptr_t middle = low + ((high - low) / 2);
+					if ((void *)_subAreaTable[middle].firstObject <= freeEntry) {
+						low = middle;
+					} else {
+						high = middle;
+					}
+				}
+				_subAreaTable[low].fragmentedBytes += freeSize;
+			}
+			freeEntry = memoryPool->getNextFreeStartingAddr(env, freeEntry);
+		}
+		runStart = runEnd;
+	}
+
+	uintptr_t windowLength = OMR_MAX(1, (evacuateCandidates * _extensions->compactIncrementalWindowPercentage) / 100);
+
+	MM_CompactWindow window = MM_CompactWindow::select(_subAreaTable, subAreaCount, windowLength, SubAreaEntry::end_segment);
+	uintptr_t bestStart = window._start;
+	uintptr_t bestEnd = window._end;
+	uintptr_t bestFragmentedBytes = window._fragmentedBytes;
+
+	uintptr_t evacuatedSubAreas = 0;
+	uintptr_t fixupOnlySubAreas = 0;
+	for (uintptr_t i = 0; i < subAreaCount; i++) {
+		if (SubAreaEntry::init == _subAreaTable[i].state) {
+			if ((i >= bestStart) && (i < bestEnd)) {
+				evacuatedSubAreas += 1;
+			} else {
+				_subAreaTable[i].state = SubAreaEntry::fixup_only;
+				fixupOnlySubAreas += 1;
+			}
+		}
+	}
+
+	if (bestStart == bestEnd) {
+		_compactFrom = (omrobjectptr_t)_heap->getHeapTop();
+		_compactTo = (omrobjectptr_t)_heap->getHeapBase();
+	} else {
+		_compactFrom = _subAreaTable[bestStart].firstObject;
+		_compactTo = _subAreaTable[bestEnd].firstObject;
+	}
+
+	env->_compactStats._evacuatedSubAreas = evacuatedSubAreas;
+	env->_compactStats._fixupOnlySubAreas = fixupOnlySubAreas;
+	env->_compactStats._windowFragmentedBytes = bestFragmentedBytes;
+
+	Trc_MM_CompactScheme_selectIncrementalWindow(env->getLanguageVMThread(), _compactFrom, _compactTo, evacuatedSubAreas, bestFragmentedBytes, fixupOnlySubAreas);
+}
+
 /**
  *  Complete setup for each sub area.
  */
@@ -551,6 +642,13 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		/* Reset largestFreeEntry of all subSpaces at beginning of compaction */
 		_extensions->heap->resetLargestFreeEntry();
 
+		/* Aggressive compactions and compactions to contract or to recover an aborted scavenge need the whole heap */
+		CompactReason compactReason = (CompactReason)_extensions->globalGCStats.compactStats._compactReason;
+		_incrementalCycle = _extensions->compactIncremental
+			&& !aggressive
+			&& (COMPACT_CONTRACT != compactReason)
+			&& (COMPACT_ABORTED_SCAVENGE != compactReason);
+
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
@@ -701,6 +799,11 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 
 				currentFreeBase = NULL;
 				currentFreeSize = 0;
+
+				if (SubAreaEntry::fixup_only == subAreaTable[i].state) {
+					/* Nothing moved here, so the holes the sweep left between live objects are still free */
+					currentFreeBase = rebuildFreelistInFixupOnlySubArea(env, memorySubSpace, poolState, subAreaTable[i].firstObject, subAreaTable[i + 1].firstObject);
+				}
 			}
         } while (subAreaTable[i++].state != SubAreaEntry::end_segment);
 
@@ -715,6 +818,29 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 	}
 }
 
+/*
+ * Add the gaps between the marked objects of a fixup_only sub area to the free list.
+ *
+ * @param start First object (or segment base) of the sub area
+ * @param end First object of the next sub area
+ * @return Base of the free memory trailing the last marked object, or NULL if there is none
+ */
+void *
+MM_CompactScheme::rebuildFreelistInFixupOnlySubArea(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, omrobjectptr_t start, omrobjectptr_t end)
+{
+	omrobjectptr_t freeBase = start;
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)start, (uintptr_t *)pageStart(pageIndex(end)));
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+		if (objectPtr > freeBase) {
+			addFreeEntry(env, memorySubSpace, poolState, (void *)freeBase, (uintptr_t)objectPtr - (uintptr_t)freeBase);
+		}
+		freeBase = (omrobjectptr_t)((uintptr_t)objectPtr + _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr));
+	}
+
+	return (freeBase < end) ? (void *)freeBase : NULL;
+}
+
 /*
  * Call appropriate Memory Pool to add a new free entry to the pool. If the free entry
  * spans more than one subpool then it will be split into 2 free entries.
@@ -1412,7 +1538,7 @@ MM_CompactScheme::rebuildMarkbits(MM_EnvironmentStandard *env)
 		intptr_t i;
         for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
         	/* We only have to rebuild the markbits for sub areas which contain moved objects */
-        	if (subAreaTable->state != SubAreaEntry::fixup_only) {
+        	if (subAreaTable[i].state != SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::rebuilding_mark_bits)) {
 	        		rebuildMarkbitsInSubArea(env, region, subAreaTable, i);
 				}
@@ -1477,7 +1603,7 @@ MM_CompactScheme::parallelFixHeapForWalk(MM_EnvironmentBase *env)
         	if (subAreaTable[i].state == SubAreaEntry::fixup_only) {
 	        	if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::fixing_heap_for_walk)) {
 	        		omrobjectptr_t start = subAreaTable[i].firstObject;
-					omrobjectptr_t end   = subAreaTable[i].firstObject;
+					omrobjectptr_t end   = subAreaTable[i + 1].firstObject;
 					omrobjectptr_t alignedEnd = pageStart(pageIndex(end));
 
 					GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, false);
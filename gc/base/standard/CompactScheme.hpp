@@ -93,6 +93,7 @@ private:
 		omrobjectptr_t freeChunk;
         volatile uintptr_t state;
         volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+        uintptr_t fragmentedBytes; /**< bytes held by small free entries at setup time, used to choose an incremental compaction window */
         
     	/* legal values for currentAction */
     	enum {
@@ -138,6 +139,7 @@ protected:
     SubAreaEntry *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
     omrobjectptr_t _compactFrom;
     omrobjectptr_t _compactTo;
+    bool _incrementalCycle; /**< true if this compaction only evacuates a window of sub areas, the rest being fixup_only */
     MM_CompactDelegate _delegate;
 
 public:
@@ -167,6 +169,15 @@ protected:
      */
     void setRealLimitsSubAreas(MM_EnvironmentStandard *env);
     void removeNullSubAreas(MM_EnvironmentStandard *env);
+    /**
+     * Pick the contiguous run of sub areas holding the most fragmented free memory and
+     * turn every other sub area into a fixup_only one. Called single threaded once the
+     * null sub areas have been removed.
+     *
+     * @param env[in] the current thread
+     * @param subAreaCount[in] the number of entries left in the sub area table
+     */
+    void selectIncrementalWindow(MM_EnvironmentStandard *env, uintptr_t subAreaCount);
     void completeSubAreaTable(MM_EnvironmentStandard *env);
 
     void saveForwardingPtr(class CompactTableEntry&,
@@ -218,6 +229,11 @@ protected:
 	void fixupObjects(MM_EnvironmentStandard *env, uintptr_t& objectCount);
 
     void rebuildFreelist(MM_EnvironmentStandard *env);
+    void *rebuildFreelistInFixupOnlySubArea(MM_EnvironmentStandard *env,
+					MM_MemorySubSpace *memorySubSpace,
+					MM_CompactMemoryPoolState *poolState,
+					omrobjectptr_t start,
+					omrobjectptr_t end);
 
     void addFreeEntry(MM_EnvironmentStandard *env,
 					MM_MemorySubSpace *memorySubSpace,
@@ -334,6 +350,7 @@ public:
         , _markMap(markingScheme->getMarkMap())
         , _subAreaTableSize(0)
     	, _subAreaTable(NULL)
+    	, _incrementalCycle(false)
     	, _delegate()
     {
     	_typeId = __FUNCTION__;
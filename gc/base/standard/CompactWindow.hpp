@@ -0,0 +1,89 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(COMPACTWINDOW_HPP_)
+#define COMPACTWINDOW_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+/**
+ * The window of sub areas evacuated by an incremental compaction.
+ * Kept apart from MM_CompactScheme so the selection can be exercised without a heap.
+ */
+class MM_CompactWindow
+{
+public:
+	uintptr_t _start; /**< index of the first sub area in the window */
+	uintptr_t _end; /**< index one past the last sub area in the window */
+	uintptr_t _fragmentedBytes; /**< sum of the fragmented bytes of the sub areas in the window */
+
+	/**
+	 * @return true if the window holds no sub areas
+	 */
+	MMINLINE bool isEmpty() const { return _start == _end; }
+
+	/**
+	 * Slide a window of up to windowLength entries over every segment of a sub area table and return the one
+	 * holding the most fragmented bytes. Segments are delimited by entries in the end segment state, and a window
+	 * never spans one since forwarding pointers are only looked up inside a single [from, to) range. Ties go to
+	 * the lowest window.
+	 *
+	 * @param table[in] the sub area table; entries need a state and a fragmentedBytes field
+	 * @param count[in] the number of entries in the table
+	 * @param windowLength[in] the maximum number of sub areas in the window, at least 1
+	 * @param endSegmentState[in] the state value marking the end of a segment
+	 * @return the selected window, empty if no segment holds a sub area
+	 */
+	template <typename SubAreaEntry>
+	static MM_CompactWindow
+	select(const SubAreaEntry *table, uintptr_t count, uintptr_t windowLength, uintptr_t endSegmentState)
+	{
+		MM_CompactWindow best = {0, 0, 0};
+		uintptr_t segmentStart = 0;
+		while (segmentStart < count) {
+			uintptr_t segmentEnd = segmentStart;
+			while ((segmentEnd < count) && (endSegmentState != table[segmentEnd].state)) {
+				segmentEnd += 1;
+			}
+			uintptr_t windowStart = segmentStart;
+			uintptr_t windowFragmentedBytes = 0;
+			for (uintptr_t i = segmentStart; i < segmentEnd; i++) {
+				windowFragmentedBytes += table[i].fragmentedBytes;
+				if ((i - windowStart) >= windowLength) {
+					windowFragmentedBytes -= table[windowStart].fragmentedBytes;
+					windowStart += 1;
+				}
+				if (best.isEmpty() || (windowFragmentedBytes > best._fragmentedBytes)) {
+					best._start = windowStart;
+					best._end = i + 1;
+					best._fragmentedBytes = windowFragmentedBytes;
+				}
+			}
+			segmentStart = segmentEnd + 1;
+		}
+		return best;
+	}
+};
+
+#endif /* COMPACTWINDOW_HPP_ */
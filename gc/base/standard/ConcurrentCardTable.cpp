@@ -28,6 +28,7 @@
 #include <stdlib.h>
 
 #include "AtomicOperations.hpp"
+#include "Bits.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentGC.hpp"
 #include "ConcurrentGCStats.hpp"
@@ -467,6 +468,9 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 		 * the heap alignment is a exact multiple of card size
 		 */
 		assume0(_extensions->heapAlignment % CARD_SIZE == 0);
+
+		/* findDirtyCardRun() skips clean cards a slot at a time, which requires clean cards to be zero */
+		Assert_MM_true(0 == CARD_CLEAN);
 	
 		_lastCard = getCardTableStart();
 	
@@ -1056,6 +1060,7 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 {
 	uintptr_t traceCount = 0;
 	Card * nextDirtyCard;
+	Card * dirtyRunTop = NULL;
 	omrobjectptr_t objectPtr;
 	uintptr_t objects;
 	uintptr_t cards = 0;
@@ -1069,28 +1074,31 @@ MM_ConcurrentCardTable::finalCleanCards(MM_EnvironmentBase *env, uintptr_t *byte
 
 	MM_MarkMap *markMap = _markingScheme->getMarkMap();
 	
+	/* Contiguous dirty cards are claimed as one run, so parallel threads contend once per run rather than once per card */
 	for ( ;
-		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false)) != NULL;
+		(nextDirtyCard= getNextDirtyCard(env, _finalCardCleanMask, false, FINAL_CLEAN_CARDS_MAX_RUN, &dirtyRunTop)) != NULL;
 		) {
 
 		/* Should never get EXCLUSIVE_VMACCESS_REQUESTED in final clean cards phase */
 		assume0(nextDirtyCard != (Card *)EXCLUSIVE_VMACCESS_REQUESTED);
 
-		/* Reset counters if we are now cleaning phase 2 cards */
-		if(!phase2 && nextDirtyCard >= _firstCardInPhase2) {
-			incFinalCleanedCards(cards, phase2);
-			cards = 0;
-			phase2 = true;
-		}
+		for (Card *card = nextDirtyCard; card < dirtyRunTop; card++) {
+			/* Reset counters if we are now cleaning phase 2 cards */
+			if(!phase2 && card >= _firstCardInPhase2) {
+				incFinalCleanedCards(cards, phase2);
+				cards = 0;
+				phase2 = true;
+			}
 
-		/* Clean the card before we trace into it */
-		finalCleanCard(nextDirtyCard);
-		cards += 1;
+			/* Clean the card before we trace into it */
+			finalCleanCard(card);
+			cards += 1;
+		}
 
-		/* Calculate address of first slot heap for the card to be cleaned... */
+		/* Calculate address of first slot heap for the cards to be cleaned... */
 		uintptr_t *heapBase = (uintptr_t *)cardAddrToHeapAddr(env,nextDirtyCard);
 		/* ..and address of last slot N.B Range is EXCLUSIVE */
-		uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + CARD_SIZE);
+		uintptr_t *heapTop = (uintptr_t *)((uint8_t *)heapBase + (CARD_SIZE * (uintptr_t)(dirtyRunTop - nextDirtyCard)));
 
 		/* Then iterate over all marked objects in the heap between the two addresses */
 		MM_HeapMapIterator markedObjectIterator(_extensions, markMap, heapBase, heapTop);
@@ -1607,13 +1615,15 @@ MM_ConcurrentCardTable::resetCleaningRanges(MM_EnvironmentBase *env)
  *
  * @param cardMask - mask to apply to cards to identify those cards the caller
  * 					 is interested in
+ * @param maxRunCards - maximum number of contiguous cards of interest claimed by one call
+ * @param runTop - if not NULL, returns the card following the last card claimed
  *
  * @return Routine either returns address of next dirty card, NULL if no
  * more dirty cards, EXCLUSIVE_VMACCESS_REQUESTED if another thread waiting
  * for exclusive VM access.
  */
 Card*
-MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean)
+MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean, uintptr_t maxRunCards, Card **runTop)
 {
 	/* Get a local copy of next current range being cleaned */
 	CleaningRange *currentRange = (CleaningRange *)_currentCleaningRange;
@@ -1635,49 +1645,16 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 		/* CMVC 132231 - cache _lastCardInPhase since it's volatile and min reads its arguments twice */
 		Card *lastCardInPhase = _lastCardInPhase;
 		Card *lastCardToClean = OMR_MIN(lastCardInPhase, currentRange->topCard);
-		Card *nextDirtyCard, *currentCard;
-
-		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
-
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
-	 		 * scan the card table.
-	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
-				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
-				 */
-				currentCard = (Card *)nextSlot;
-
-				if (currentCard >= lastCardToClean) {
-					break;
-				}
-			}
-
-			/* Have we found a card of interest yet ? */
-			if (0 == (*currentCard & cardMask)) {
-				/* No..so get next card. */
-				continue;
-			}
-
-			/* Yes..so check to see if another thread got to next dirty card before us ? */
-			if (firstCard != (Card *)currentRange->nextCard) {
-				/* Yes..so re-sync with race winner and start scan again */
-				break;
-			} else {
-				/* No .. so attempt to grab this card*/
-				nextDirtyCard = currentCard;
-				currentCard += 1;
+		Card *dirtyRunTop = NULL;
+		Card *nextDirtyCard = findDirtyCardRun(firstCard, lastCardToClean, cardMask, maxRunCards, &dirtyRunTop);
+		Card *currentCard = lastCardToClean;
+
+		if (NULL != nextDirtyCard) {
+			currentCard = nextDirtyCard;
+			/* Check to see if another thread got to next dirty card before us. If not, attempt to grab
+			 * this card along with the run of cards of interest which follows it
+			 */
+			if (firstCard == (Card *)currentRange->nextCard) {
 				if (concurrentCardClean && env->isExclusiveAccessRequestWaiting()) {
 					return (Card *)EXCLUSIVE_VMACCESS_REQUESTED;
 				}
@@ -1685,18 +1662,19 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 				/* Update next card to clean for next caller of getNextDirtyCard. If we fail
 				 * then someone beat us to it so re-sync with race winner and start again
 				 */
-				if (firstCard != (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
+				if (firstCard == (Card *)MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&currentRange->nextCard,
 											  							  (uintptr_t)firstCard,
-											  							  (uintptr_t)currentCard)) {
-					break;
+											  							  (uintptr_t)dirtyRunTop)) {
+					if (NULL != runTop) {
+						*runTop = dirtyRunTop;
+					}
+					return nextDirtyCard;
 				}
-				
-				return nextDirtyCard;
 			}
-		} /* of currentCard < lastCardToClean */
+		}
 
-		/* We get here if we break out of FOR loop when another thread beat us to next
-		 * dirty card or we reach then end of the card table.
+		/* We get here if another thread beat us to next dirty card or we reach then end
+		 * of the card table.
 		 *
 		 * Did we reach end of card table segment ?
 		 */
@@ -1738,6 +1716,44 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 	return NULL;
 }
 
+Card *
+MM_ConcurrentCardTable::findDirtyCardRun(Card *card, Card *lastCard, Card cardMask, uintptr_t maxRunCards, Card **runTop)
+{
+	/* Clean cards are zero (checked in initialize()), so a slot of clean cards is zero too */
+	for (; card < lastCard; card++) {
+		/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
+		 * at a time until we find a slot which is non-zero or the end of card table
+		 * found. This is based on the premise that the card table will be mostly
+		 * empty and scanning an uintptr_t at a time will reduce the time taken to
+		 * scan the card table.
+		 */
+		if (((Card)CARD_CLEAN == *card) && (0 == (uintptr_t)card % sizeof(uintptr_t))) {
+			/* Last card may be in middle of a slot so only scan up to an including last
+			 * complete slots worth of cards; then go card at a time
+			 */
+			uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCard);
+			card = (Card *)MM_Bits::findNonZeroSlot((uintptr_t *)card, lastSlot);
+			if (card >= lastCard) {
+				break;
+			}
+		}
+
+		/* Have we found a card of interest yet ? */
+		if (0 != (*card & cardMask)) {
+			Card *runLimit = OMR_MIN(lastCard, card + maxRunCards);
+			Card *top = card + 1;
+			while ((top < runLimit) && (0 != (*top & cardMask))) {
+				top += 1;
+			}
+			*runTop = top;
+			return card;
+		}
+	}
+
+	*runTop = lastCard;
+	return NULL;
+}
+
 /**
  * Set TLH mark bits
  *
@@ -66,6 +66,10 @@
 #define FINAL_CARD_CLEAN_MASK (CARD_DIRTY)
 
 #define SLOT_ALL_CLEAN (uintptr_t)CARD_CLEAN
+
+/* Maximum number of contiguous dirty cards claimed (and traced) as one unit of final card cleaning work */
+#define FINAL_CLEAN_CARDS_MAX_RUN 64
+
 #define EXCLUSIVE_VMACCESS_REQUESTED ((uintptr_t)-1)
  
 /**
@@ -230,7 +234,7 @@ protected:
 	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
 	
 	bool cleanSingleCard(MM_EnvironmentBase *env, Card *card, uintptr_t bytesToClean, uintptr_t *totalBytesCleaned);
-	Card* getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean);
+	Card* getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask, bool concurrentCardClean, uintptr_t maxRunCards = 1, Card **runTop = NULL);
 	
 	bool cardHasMarkedObjects(MM_EnvironmentBase *env, Card *card);
 	
@@ -286,6 +290,18 @@ protected:
 	}
 
 public:
+	/**
+	 * Find the first card of interest in [card, lastCard), and the run of contiguous cards of interest
+	 * starting with it. Clean cards are skipped a slot at a time.
+	 * @param card first card to look at
+	 * @param lastCard card following the last card to look at
+	 * @param cardMask mask to apply to cards to identify those cards of interest
+	 * @param maxRunCards maximum number of cards in the run, at least 1
+	 * @param[out] runTop the card following the last card of the run, lastCard if none found
+	 * @return the first card of interest, NULL if there is none
+	 */
+	static Card *findDirtyCardRun(Card *card, Card *lastCard, Card cardMask, uintptr_t maxRunCards, Card **runTop);
+
 	/**
 	 * Creates and returns a new instance of the card table.
 	 * @param[in] env The thread starting up the collector
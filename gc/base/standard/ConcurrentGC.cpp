@@ -2984,8 +2984,10 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 		if (_stats.switchExecutionMode(executionModeAtGC, CONCURRENT_OFF)) {
 #if defined(OMR_GC_REALTIME)
 			if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
-				if (((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->inUsePacketsAvailable(env)) {
-					((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->moveInUseToNonEmpty(env);
+				MM_WorkPacketsSATB *workPacketsSATB = (MM_WorkPacketsSATB *)_markingScheme->getWorkPackets();
+				workPacketsSATB->drainFlushedBarrierPackets(env);
+				if (workPacketsSATB->inUsePacketsAvailable(env)) {
+					workPacketsSATB->moveInUseToNonEmpty(env);
 					_extensions->sATBBarrierRememberedSet->flushFragments(env);
 				}
 			}
@@ -42,6 +42,10 @@
 #include "ConcurrentGCSATB.hpp"
 #include "AllocateDescription.hpp"
 
+#if defined(OMR_GC_REALTIME)
+#include "WorkPacketsSATB.hpp"
+#endif /* defined(OMR_GC_REALTIME) */
+
 /**
  * Create new instance of ConcurrentGCIncrementalUpdate object.
  *
@@ -90,7 +94,13 @@ MM_ConcurrentGCSATB::tearDown(MM_EnvironmentBase *env)
 
 void
 MM_ConcurrentGCSATB::reportConcurrentHalted(MM_EnvironmentBase *env)
-{}
+{
+#if defined(OMR_GC_REALTIME)
+	MM_WorkPacketsSATB *workPackets = (MM_WorkPacketsSATB *)_markingScheme->getWorkPackets();
+	Trc_MM_ConcurrentGCSATB_barrierPacketFlushes(env->getLanguageVMThread(), workPackets->getBarrierPacketFlushCount(), workPackets->getBarrierPacketDrainCount());
+	workPackets->resetBarrierPacketCounts();
+#endif /* defined(OMR_GC_REALTIME) */
+}
 
 uintptr_t
 MM_ConcurrentGCSATB::localMark(MM_EnvironmentBase *env, uintptr_t sizeToTrace)
@@ -104,6 +114,11 @@ MM_ConcurrentGCSATB::localMark(MM_EnvironmentBase *env, uintptr_t sizeToTrace)
 	Assert_MM_true(_concurrentCycleState._referenceObjectOptions == MM_CycleState::references_default);
 	env->_cycleState = &_concurrentCycleState;
 
+#if defined(OMR_GC_REALTIME)
+	/* Make barrier packets flushed by mutators since the last increment available for tracing */
+	((MM_WorkPacketsSATB *)_markingScheme->getWorkPackets())->drainFlushedBarrierPackets(env);
+#endif /* defined(OMR_GC_REALTIME) */
+
 	uintptr_t sizeTraced = 0;
 	while(NULL != (objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env))) {
 		/* Check for array scanPtr..if we find one ignore it*/
@@ -352,5 +352,38 @@ MM_CopyScanCacheList::popCache(MM_EnvironmentBase *env)
 	return cache;
 }
 
+MM_CopyScanCacheStandard *
+MM_CopyScanCacheList::popCacheOnNode(MM_EnvironmentBase *env, uintptr_t numaNode)
+{
+	uintptr_t index = getSublistIndex(env);
+	MM_CopyScanCacheStandard *cache = NULL;
+
+	for (uintptr_t i = 0; i < _sublistCount; i++) {
+		MM_CopyScanCacheList::CopyScanCacheSublist *list = &_sublists[index];
+		MM_CopyScanCacheStandard *head = list->_cacheHead;
+
+		/* The node is only peeked at without the lock; cache headers outlive the scavenge, and whatever is found at the head
+		 * once the lock is held is taken since it is work regardless of its node */
+		if ((NULL != head) && (numaNode == head->_numaNode)) {
+			env->_scavengerStats._acquireListLockCount += 1;
+			list->_cacheLock.acquire();
+			cache = list->_cacheHead;
+			if (NULL != cache) {
+				list->_cacheHead = (MM_CopyScanCacheStandard *)cache->next;
+				decrementCount(list, 1);
+			}
+			list->_cacheLock.release();
+
+			if (NULL != cache) {
+				break;
+			}
+		}
+
+		index = (index + 1) % _sublistCount;
+	}
+
+	return cache;
+}
+
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
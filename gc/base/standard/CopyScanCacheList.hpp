@@ -194,6 +194,14 @@ public:
 	 */
 	MM_CopyScanCacheStandard *popCache(MM_EnvironmentBase *env);
 
+	/**
+	 * Pop a cache entry backed by memory on the given NUMA node, searching the sublists starting from the thread's own.
+	 * @param env[in] the current GC thread
+	 * @param numaNode[in] the preferred NUMA node (1-based)
+	 * @return the cache entry, or NULL if no sublist head is on the node
+	 */
+	MM_CopyScanCacheStandard *popCacheOnNode(MM_EnvironmentBase *env, uintptr_t numaNode);
+
 	/**
 	 * Create a CopyScanCacheList object.
 	 */
@@ -52,6 +52,7 @@ public:
 	uintptr_t _arraySplitIndex; /**< The index within a split array to start scanning from (meaningful if OMR_SCAVENGER_CACHE_TYPE_SPLIT_ARRAY is set) */
 	uintptr_t _arraySplitAmountToScan; /**< The amount of elements that should be scanned by split array scanning. */
 	omrobjectptr_t* _arraySplitRememberedSlot; /**< A pointer to the remembered set slot a split array came from if applicable. */
+	uintptr_t _numaNode; /**< NUMA node (1-based) of the memory backing the cache, or 0 if unknown or not tracked */
 
 	/* Members Function */
 private:
@@ -83,6 +84,7 @@ public:
 		, _arraySplitIndex(0)
 		, _arraySplitAmountToScan(0)
 		, _arraySplitRememberedSlot(NULL)
+		, _numaNode(0)
 	{}
 };
 
@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif /* defined(__SSE2__) */
+
+#include "omrutil.h"
+
+#include "Dispatcher.hpp"
+#include "EnvironmentBase.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "Math.hpp"
+#include "MemoryPool.hpp"
+
+#include "ParallelPreZeroTask.hpp"
+
+/* Size of the work units the free entries are split into */
+#define PRE_ZERO_CHUNK_SIZE ((uintptr_t)256 * 1024)
+
+void
+MM_ParallelPreZeroTask::zeroNonTemporal(void *base, uintptr_t size)
+{
+#if defined(__SSE2__)
+	uint8_t *current = (uint8_t *)base;
+	uint8_t *top = current + size;
+	uint8_t *alignedBase = (uint8_t *)MM_Math::roundToCeiling(sizeof(__m128i), (uintptr_t)current);
+	uint8_t *alignedTop = (uint8_t *)MM_Math::roundToFloor(sizeof(__m128i), (uintptr_t)top);
+
+	if (alignedBase < alignedTop) {
+		memset(current, 0, alignedBase - current);
+		const __m128i zero = _mm_setzero_si128();
+		for (__m128i *vector = (__m128i *)alignedBase; vector < (__m128i *)alignedTop; vector++) {
+			_mm_stream_si128(vector, zero);
+		}
+		/* Streaming stores are weakly ordered - make them visible before the memory is handed out */
+		_mm_sfence();
+		memset(alignedTop, 0, top - alignedTop);
+	} else {
+		memset(current, 0, size);
+	}
+#else /* defined(__SSE2__) */
+	OMRZeroMemory(base, size);
+#endif /* defined(__SSE2__) */
+}
+
+void
+MM_ParallelPreZeroTask::run(MM_EnvironmentBase *env)
+{
+	MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)_memoryPool->getFirstFreeStartingAddr(env);
+
+	while (NULL != freeEntry) {
+		uintptr_t entryBase = (uintptr_t)freeEntry + sizeof(MM_HeapLinkedFreeHeader);
+		uintptr_t entryTop = (uintptr_t)freeEntry->afterEnd();
+		for (uintptr_t chunkBase = entryBase; chunkBase < entryTop; chunkBase += PRE_ZERO_CHUNK_SIZE) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				zeroNonTemporal((void *)chunkBase, OMR_MIN(PRE_ZERO_CHUNK_SIZE, entryTop - chunkBase));
+			}
+		}
+		freeEntry = (MM_HeapLinkedFreeHeader *)_memoryPool->getNextFreeStartingAddr(env, freeEntry);
+	}
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
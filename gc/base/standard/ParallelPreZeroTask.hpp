@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(GC_BASE_STANDARD_PARALLELPREZEROTASK_HPP_)
+#define GC_BASE_STANDARD_PARALLELPREZEROTASK_HPP_
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "omrmodroncore.h"
+
+#include "ParallelTask.hpp"
+
+class MM_Dispatcher;
+class MM_EnvironmentBase;
+class MM_MemoryPool;
+
+/**
+ * Zero the free memory of a memory pool (all but the free entry headers) on the GC threads, using non-temporal
+ * stores where available so that the zeroing does not displace the caches.
+ * Used at the end of a scavenge on the allocate space, so that TLH refreshes from it need not clear the memory.
+ * @see MM_MemoryPool::claimPreZeroedRange()
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelPreZeroTask : public MM_ParallelTask
+{
+private:
+	MM_MemoryPool *_memoryPool; /**< Pool whose free entries are zeroed */
+
+public:
+	virtual UDATA getVMStateID() { return OMRVMSTATE_GC_SCAVENGE; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	/**
+	 * Zero [base, base + size), bypassing the caches where supported.
+	 */
+	static void zeroNonTemporal(void *base, uintptr_t size);
+
+	/**
+	 * Create a ParallelPreZeroTask object.
+	 */
+	MM_ParallelPreZeroTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_MemoryPool *memoryPool) :
+		MM_ParallelTask(env, dispatcher)
+		, _memoryPool(memoryPool)
+	{
+		_typeId = __FUNCTION__;
+	};
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* GC_BASE_STANDARD_PARALLELPREZEROTASK_HPP_ */
@@ -107,6 +107,14 @@ MM_ParallelScavengeTask::synchronizeGCThreadsAndReleaseSingleThread(MM_Environme
 	return result;
 }
 
+uint64_t
+MM_ParallelScavengeTask::getThreadStallTime(MM_EnvironmentBase *envBase)
+{
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
+
+	return env->_scavengerStats.getStallTime();
+}
+
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
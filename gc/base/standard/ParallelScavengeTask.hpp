@@ -77,6 +77,12 @@ public:
 	 * @see MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread
 	 */
 	virtual bool synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id);
+
+	/**
+	 * Report the work, complete and sync stall time collected in the thread's scavenger stats.
+	 * @see MM_Task::getThreadStallTime
+	 */
+	virtual uint64_t getThreadStallTime(MM_EnvironmentBase *env);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	/**
@@ -62,6 +62,38 @@ public:
 		}
 	}
 
+	/*
+	 * Mark object as Remembered. Safe to call from several threads sharing the same mark map.
+	 * All Mark work should be completed before first nextObject call.
+	 * @param objectPtr address of object to mark
+	 */
+	MMINLINE void atomicAddObject(omrobjectptr_t objectPtr)
+	{
+		if (!_searchMode) {
+			_markMap->atomicSetBit(objectPtr);
+		} else {
+			/* Update of mark map in Search mode is forbidden */
+			Assert_MM_unreachable();
+		}
+	}
+
+	/*
+	 * Restrict the search for Remembered objects to the given heap range and switch to Search mode.
+	 * Objects are returned only if they start within the range.
+	 * @param base lowest heap address to search
+	 * @param top heap address to stop search at
+	 */
+	MMINLINE void setSearchRange(uintptr_t *base, uintptr_t *top)
+	{
+		_markedObjectIterator.reset(_markMap, base, top);
+		_searchMode = true;
+	}
+
+	/**
+	 * @return the mark map used to record Remembered objects
+	 */
+	MMINLINE MM_MarkMap *getMarkMap() { return _markMap; }
+
 	/*
 	 * Get next object marked as Remembered
 	 * First call will disable modifications in mark map and reinitialize iterator
@@ -89,6 +121,19 @@ public:
 		initialize(env);
 	}
 
+	/**
+	 * Construct a new RSOverflow sharing the mark map of an RSOverflow already created
+	 * by another thread, so that Remembered objects can be recorded and searched in parallel.
+	 * @param markMap the mark map returned by getMarkMap() of the initialized RSOverflow
+	 */
+	MMINLINE MM_RSOverflow(MM_EnvironmentBase *env, MM_MarkMap *markMap)
+		: _extensions(env->getExtensions())
+		, _markMap(markMap)
+		, _searchMode(false)
+		, _markedObjectIterator(env->getExtensions())
+	{
+	}
+
 protected:
 private:
 
@@ -281,7 +281,8 @@ MM_RememberedSetSATB::refreshFragment(MM_EnvironmentBase *env, MM_GCRememberedSe
 		
 	if ((NULL != oldPacket) && (getLocalFragmentIndex(env, fragment) == getGlobalFragmentIndex(env)) && (*fragment->fragmentTop == *fragment->fragmentAlloc)) {
 		_workPackets->removePacketFromInUseList(env, oldPacket);
-		_workPackets->putFullPacket(env, oldPacket);
+		/* Hand the full packet to the collector without taking the full packet list lock */
+		_workPackets->flushBarrierPacket(env, oldPacket);
 	}
 	
 	if (J9GC_REMEMBERED_SET_RESERVED_INDEX == fragment->localFragmentIndex) {
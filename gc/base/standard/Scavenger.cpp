@@ -58,6 +58,7 @@
 #include "ForwardedHeader.hpp"
 #include "IndexableObjectScanner.hpp"
 #include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
@@ -74,6 +75,7 @@
 #include "ObjectScanner.hpp"
 #include "OMRVMInterface.hpp"
 #include "OMRVMThreadListIterator.hpp"
+#include "ParallelPreZeroTask.hpp"
 #include "ParallelScavengeTask.hpp"
 #include "PhysicalSubArena.hpp"
 #include "RSOverflow.hpp"
@@ -105,6 +107,9 @@
 #define FLIP_TENURE_LARGE_SCAN 4
 #define FLIP_TENURE_LARGE_SCAN_DEFERRED 5
 
+/* Heap bytes per work unit when scanning remembered objects recorded in RS Overflow (card aligned), and minimum bytes per Tenure chunk when finding them */
+#define RS_OVERFLOW_SCAN_UNIT_SIZE (CARD_SIZE * 1024)
+
 /* VM Design 1774: Ideally we would pull these cache line values from the port library but this will suffice for
  * a quick implementation
  */
@@ -246,6 +251,7 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	 * will contain a valid entry. We set the appropriate number of caches per thread here */
 	switch (_extensions->scavengerScanOrdering) {
 	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST:
+	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST:
 		_cachesPerThread = FLIP_TENURE_LARGE_SCAN;
 		break;
 	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL:
@@ -452,6 +458,11 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	/* record that this thread is participating in this cycle */
 	env->_scavengerStats._gcCount = _extensions->scavengerStats._gcCount;
 
+	if (_extensions->numaAwareGencon && env->isMasterThread()) {
+		/* slaves are placed on their nodes by the dispatcher; the master borrows a mutator thread, so use whatever affinity it has */
+		env->setNumaNode(env->getNumaAffinity());
+	}
+
 	/* Reset the local remembered set fragment */
 	env->_scavengerRememberedSet.count = 0;
 	env->_scavengerRememberedSet.fragmentCurrent = NULL;
@@ -478,6 +489,7 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
 	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState);
 	_dispatcher->run(env, &scavengeTask);
+	_extensions->scavengerStats._threadCount = scavengeTask.getThreadCount();
 
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
@@ -512,6 +524,19 @@ MM_Scavenger::reportScavengeEnd(MM_EnvironmentStandard *env, bool lastIncrement)
 		_extensions->scavengerStats._tiltRatio = calculateTiltRatio();
 
 		Trc_MM_Tiltratio(env->getLanguageVMThread(), _extensions->scavengerStats._tiltRatio);
+
+		if (_extensions->scavengerSurvivalCensus && scavengeSuccessful) {
+			TRIGGER_J9HOOK_MM_OMR_SCAVENGE_SURVIVAL_CENSUS(
+				_extensions->omrHookInterface,
+				env->getOmrVMThread(),
+				omrtime_hires_clock(),
+				_extensions->scavengerStats._gcCount,
+				&_extensions->scavengerStats._survivalCensus[0][0],
+				OMR_SCAVENGER_CENSUS_AGES,
+				OMR_SCAVENGER_CENSUS_SIZE_CLASSES,
+				OMR_SCAVENGER_CENSUS_SIZE_CLASS_SHIFT
+			);
+		}
 	}
 
 	TRIGGER_J9HOOK_MM_PRIVATE_SCAVENGE_END(
@@ -722,7 +747,21 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	for (uintptr_t i = 0; i < OMR_SCAVENGER_CACHESIZE_BINS; i++) {
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
+	if (_extensions->scavengerSurvivalCensus) {
+		for (uintptr_t age = 0; age < OMR_SCAVENGER_CENSUS_AGES; age++) {
+			for (uintptr_t sizeClass = 0; sizeClass < OMR_SCAVENGER_CENSUS_SIZE_CLASSES; sizeClass++) {
+				finalGCStats->_survivalCensus[age][sizeClass] += scavStats->_survivalCensus[age][sizeClass];
+			}
+		}
+	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
+	finalGCStats->_referentCopyCount += scavStats->_referentCopyCount;
+	finalGCStats->_referentAdjacentCopyCount += scavStats->_referentAdjacentCopyCount;
+	finalGCStats->_hotSlotCopyCount += scavStats->_hotSlotCopyCount;
+	finalGCStats->_crossNodeCopyCount += scavStats->_crossNodeCopyCount;
+	finalGCStats->_crossNodeCopyBytes += scavStats->_crossNodeCopyBytes;
+	finalGCStats->_localNodeScanCacheCount += scavStats->_localNodeScanCacheCount;
+	finalGCStats->_remoteNodeScanCacheCount += scavStats->_remoteNodeScanCacheCount;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
@@ -764,6 +803,25 @@ MM_Scavenger::mergeThreadGCStats(MM_EnvironmentBase *env)
 		scavStats->_releaseFreeListCount,
 		scavStats->_acquireScanListCount,
 		scavStats->_releaseScanListCount);
+
+	Trc_MM_ParallelScavenger_copyLocalityStats(
+		env->getLanguageVMThread(),
+		(uint32_t)env->getSlaveID(),
+		scavStats->_referentCopyCount,
+		scavStats->_referentAdjacentCopyCount,
+		scavStats->getReferentAdjacencyRatio(),
+		scavStats->_hotSlotCopyCount);
+
+	if (0 != env->getNumaNode()) {
+		Trc_MM_ParallelScavenger_numaStats(
+			env->getLanguageVMThread(),
+			(uint32_t)env->getSlaveID(),
+			env->getNumaNode(),
+			scavStats->_crossNodeCopyCount,
+			scavStats->_crossNodeCopyBytes,
+			scavStats->_localNodeScanCacheCount,
+			scavStats->_remoteNodeScanCacheCount);
+	}
 }
 
 void
@@ -1003,6 +1061,7 @@ MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, o
 				copyCache->flags &= OMR_SCAVENGER_CACHE_TYPE_HEAP;
 				copyCache->flags |= OMR_SCAVENGER_CACHE_TYPE_SEMISPACE | OMR_SCAVENGER_CACHE_TYPE_COPY;
 				reinitCache(copyCache, addrBase, addrTop);
+				copyCache->_numaNode = getNumaNodeForCopy(env, addrBase);
 			} else {
 				/* can not allocate a copyCache header, release allocated memory */
 				/* return memory to pool */
@@ -1123,6 +1182,7 @@ MM_Scavenger::reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env,
 				}
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
 				reinitCache(copyCache, addrBase, addrTop);
+				copyCache->_numaNode = getNumaNodeForCopy(env, addrBase);
 			} else {
 				/* can not allocate a copyCache header, release allocated memory */
 				/* return memory to pool */
@@ -1258,6 +1318,12 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, GC_SlotObject *slotObj
 	{
 		slotObject->writeReferenceToSlot(slot);
 	}
+	/* Copy locality is only reported for dynamic breadth first ordering, keep the other orderings off the stats */
+	if ((MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == _extensions->scavengerScanOrdering)
+		&& (NULL != env->_effectiveCopyScanCache)
+	) {
+		env->_scavengerStats.countReferentCopy((uintptr_t)slotObject->readAddressFromSlot(), (uintptr_t)slot);
+	}
 #if defined(OMR_SCAVENGER_TRACK_COPY_DISTANCE)
 	if (NULL != env->_effectiveCopyScanCache) {
 		env->_scavengerStats.countCopyDistance((uintptr_t)slotObject->readAddressFromSlot(), (uintptr_t)slotObject->readReferenceFromSlot());
@@ -1538,6 +1604,13 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 			scavStats->_flipBytes += objectCopySizeInBytes;
 			scavStats->getFlipHistory(0)->_flipBytes[oldObjectAge + 1] += objectReserveSizeInBytes;
 		}
+		if ((0 != copyCache->_numaNode) && (env->getNumaNode() != copyCache->_numaNode)) {
+			scavStats->_crossNodeCopyCount += 1;
+			scavStats->_crossNodeCopyBytes += objectCopySizeInBytes;
+		}
+		if (_extensions->scavengerSurvivalCensus) {
+			scavStats->countSurvivor(oldObjectAge, objectReserveSizeInBytes);
+		}
 	} else {
 		/* We have not used the reserved space now, but we will for subsequent allocations. If this space was reserved for an individual object,
 		 * we might have created a TLH remainder from previous cache just before reserving this space. This space eventaully can create another remainder.
@@ -1693,11 +1766,16 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	GC_SlotObject *slotObject = NULL;
 
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
+	bool const copyHotSlotsAhead = (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == _extensions->scavengerScanOrdering);
 	while (NULL != (slotObject = objectScanner->getNextSlot())) {
 		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
 		shouldRemember |= isSlotObjectInNewSpace;
 		if (NULL != *copyCache) {
 			slotsCopied += 1;
+			if (copyHotSlotsAhead) {
+				/* pull the hot children of the object just copied next to it before continuing breadth first */
+				copyHotSlots(env, slotObject->readReferenceFromSlot(), 1);
+			}
 		}
 		slotsScanned += 1;
 	}
@@ -1768,6 +1846,31 @@ MM_Scavenger::deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t object
 	}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 }
+
+void
+MM_Scavenger::copyHotSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t depth)
+{
+	GC_ObjectScannerState objectScannerState;
+	GC_ObjectScanner *objectScanner = getObjectScanner(env, objectPtr, &objectScannerState, GC_ObjectScanner::scanHeap);
+
+	/* Arrays are left to the breadth first scan where they can be split; leaf objects have nothing to copy */
+	if ((NULL != objectScanner) && !objectScanner->isLeafObject() && !objectScanner->isIndexableObject()) {
+		uintptr_t hotSlotsRemaining = _extensions->scavengerDynamicBreadthFirstHotSlots;
+		GC_SlotObject *slotObject = NULL;
+		while ((0 < hotSlotsRemaining) && (NULL != (slotObject = objectScanner->getNextSlot()))) {
+			/* remembering is deferred to the breadth first scan of objectPtr, which will revisit this (then forwarded) slot */
+			copyAndForward(env, slotObject);
+			if (NULL != env->_effectiveCopyScanCache) {
+				env->_scavengerStats._hotSlotCopyCount += 1;
+				if (depth < _extensions->scavengerDynamicBreadthFirstScanDepth) {
+					copyHotSlots(env, slotObject->readReferenceFromSlot(), depth + 1);
+				}
+			}
+			hotSlotsRemaining -= 1;
+		}
+	}
+}
+
 /**
  * Scans the slots of a non-indexable object, remembering objects as required. Scanning is interrupted
  * as soon as there is a copy cache that is preferred to the current scan cache. This is returned
@@ -2155,6 +2258,7 @@ MM_Scavenger::completeScan(MM_EnvironmentStandard *env)
 
 		switch (_extensions->scavengerScanOrdering) {
 		case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST:
+		case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST:
 			completeScanCache(env, scanCache);
 			break;
 		case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL:
@@ -2254,20 +2358,95 @@ MM_Scavenger::clearRememberedSetLists(MM_EnvironmentStandard *env)
 }
 
 void
-MM_Scavenger::addAllRememberedObjectsToOverflow(MM_EnvironmentStandard *env, MM_RSOverflow *overflow)
+MM_Scavenger::addAllRememberedObjectsToOverflowParallel(MM_EnvironmentStandard *env, MM_RSOverflow *overflow)
+{
+	/* Walk the heap finding all old objects that are flagged as remembered, a chunk (or a region) per work unit */
+	if (NULL != _rememberedSetOverflowChunks) {
+		for (uintptr_t i = 0; i < _rememberedSetOverflowChunkCount; i++) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				omrobjectptr_t chunkBase = (omrobjectptr_t)_rememberedSetOverflowChunks[2 * i];
+				omrobjectptr_t chunkTop = (omrobjectptr_t)_rememberedSetOverflowChunks[(2 * i) + 1];
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, chunkBase, chunkTop, false);
+				omrobjectptr_t objectPtr;
+				while((objectPtr = objectIterator.nextObject()) != NULL) {
+					if(_extensions->objectModel.isRemembered(objectPtr)) {
+						/* mark remembered objects - neighbouring chunks may share mark map words */
+						overflow->atomicAddObject(objectPtr);
+					}
+				}
+			}
+		}
+	} else {
+		MM_HeapRegionDescriptorStandard *region = NULL;
+		GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
+		while((region = regionIterator.nextRegion()) != NULL) {
+			if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
+				omrobjectptr_t objectPtr;
+				while((objectPtr = objectIterator.nextObject()) != NULL) {
+					if(_extensions->objectModel.isRemembered(objectPtr)) {
+						/* mark remembered objects - neighbouring regions may share mark map words */
+						overflow->atomicAddObject(objectPtr);
+					}
+				}
+			}
+		}
+	}
+}
+
+void
+MM_Scavenger::buildRememberedSetOverflowChunks(MM_EnvironmentStandard *env)
 {
-	/* Walk the heap finding all old objects that are flagged as remembered */
+	Assert_MM_true(NULL == _rememberedSetOverflowChunks);
+
+	/* A region holds at most one chunk per unit plus a shorter one at its top */
+	uintptr_t maxChunkCount = 0;
 	MM_HeapRegionDescriptorStandard *region = NULL;
-	GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
-	while((region = regionIterator.nextRegion()) != NULL) {
-		GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
-		omrobjectptr_t objectPtr;
-		while((objectPtr = objectIterator.nextObject()) != NULL) {
-			if(_extensions->objectModel.isRemembered(objectPtr)) {
-				/* mark remembered objects */
-				overflow->addObject(objectPtr);
+	GC_MemorySubSpaceRegionIteratorStandard countIterator(_tenureMemorySubSpace);
+	while(NULL != (region = countIterator.nextRegion())) {
+		maxChunkCount += (region->getSize() / RS_OVERFLOW_SCAN_UNIT_SIZE) + 1;
+	}
+
+	_rememberedSetOverflowChunkCount = 0;
+	_rememberedSetOverflowChunks = (void **)env->getForge()->allocate(maxChunkCount * 2 * sizeof(void *), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != _rememberedSetOverflowChunks) {
+		GC_MemorySubSpaceRegionIteratorStandard regionIterator(_tenureMemorySubSpace);
+		while(NULL != (region = regionIterator.nextRegion())) {
+			MM_MemoryPool *memoryPool = region->getSubSpace()->getMemoryPool();
+			void *regionTop = region->getHighAddress();
+			void *chunkBase = region->getLowAddress();
+			/*
+			 * The end of a free entry is the start of an object, of another free entry or of the region top.
+			 * Free entries out of order or outside the region are skipped, so chunks only grow.
+			 */
+			MM_HeapLinkedFreeHeader *freeEntry = (MM_HeapLinkedFreeHeader *)memoryPool->getFirstFreeStartingAddr(env);
+			while (NULL != freeEntry) {
+				void *freeEntryTop = freeEntry->afterEnd();
+				if (((void *)freeEntry >= chunkBase) && (freeEntryTop < regionTop)
+					&& (((uintptr_t)freeEntryTop - (uintptr_t)chunkBase) >= RS_OVERFLOW_SCAN_UNIT_SIZE)
+				) {
+					_rememberedSetOverflowChunks[2 * _rememberedSetOverflowChunkCount] = chunkBase;
+					_rememberedSetOverflowChunks[(2 * _rememberedSetOverflowChunkCount) + 1] = freeEntryTop;
+					_rememberedSetOverflowChunkCount += 1;
+					chunkBase = freeEntryTop;
+				}
+				freeEntry = (MM_HeapLinkedFreeHeader *)memoryPool->getNextFreeStartingAddr(env, freeEntry);
 			}
+			_rememberedSetOverflowChunks[2 * _rememberedSetOverflowChunkCount] = chunkBase;
+			_rememberedSetOverflowChunks[(2 * _rememberedSetOverflowChunkCount) + 1] = regionTop;
+			_rememberedSetOverflowChunkCount += 1;
 		}
+		Assert_MM_true(_rememberedSetOverflowChunkCount <= maxChunkCount);
+	}
+}
+
+void
+MM_Scavenger::freeRememberedSetOverflowChunks(MM_EnvironmentStandard *env)
+{
+	if (NULL != _rememberedSetOverflowChunks) {
+		env->getForge()->free(_rememberedSetOverflowChunks);
+		_rememberedSetOverflowChunks = NULL;
+		_rememberedSetOverflowChunkCount = 0;
 	}
 }
 
@@ -2279,8 +2458,10 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
 
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
-		/* There wasn't enough room in the current fragment - allocate a new one */
-		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
+		/* There wasn't enough room in the current fragment - allocate a new one (never, if -Xgc:fvtest=forceRememberedSetOverflow has been specified) */
+		if(_extensions->fvtest_forceRememberedSetOverflow
+			|| allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)
+		) {
 			/* Failed to allocate a fragment - set the remembered set overflow state and exit */
 			if(!isRememberedSetInOverflowState()) {
 				env->_scavengerStats._causedRememberedSetOverflow = 1;
@@ -2457,20 +2638,40 @@ MM_Scavenger::scavengeRememberedSetOverflow(MM_EnvironmentStandard *env)
 
 		/* Creation of this class will Abort Global Collector */
 		MM_RSOverflow rememberedSetOverflow(env);
+		_rememberedSetOverflowMarkMap = rememberedSetOverflow.getMarkMap();
+		buildRememberedSetOverflowChunks(env);
 
-		addAllRememberedObjectsToOverflow(env, &rememberedSetOverflow);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
 
-		/*
-		 * Scan any remembered objects, but don't adjust their remembered bit.
-		 * Objects that no longer need remembering will be pruned at the end of the scavenge.
-		 */
-		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = rememberedSetOverflow.nextObject())) {
-			scavengeRememberedObject(env, objectPtr);
-		}
+	MM_RSOverflow rememberedSetOverflow(env, _rememberedSetOverflowMarkMap);
+	addAllRememberedObjectsToOverflowParallel(env, &rememberedSetOverflow);
 
+	/* Old space must not be modified by copying until all remembered objects have been found */
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		freeRememberedSetOverflowChunks(env);
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
+
+	/*
+	 * Scan any remembered objects, but don't adjust their remembered bit.
+	 * Objects that no longer need remembering will be pruned at the end of the scavenge.
+	 * The heap is divided into card aligned units so that scanning is shared among all threads
+	 * even if remembered objects are concentrated in a single region.
+	 */
+	uintptr_t *heapBase = (uintptr_t *)_extensions->heapBaseForBarrierRange0;
+	uintptr_t *heapTop = (uintptr_t *)((uintptr_t)heapBase + _extensions->heapSizeForBarrierRange0);
+	uintptr_t unitSlots = RS_OVERFLOW_SCAN_UNIT_SIZE / sizeof(uintptr_t);
+	for (uintptr_t *unitBase = heapBase; unitBase < heapTop; unitBase += unitSlots) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t *unitTop = ((uintptr_t)(heapTop - unitBase) > unitSlots) ? (unitBase + unitSlots) : heapTop;
+			rememberedSetOverflow.setSearchRange(unitBase, unitTop);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = rememberedSetOverflow.nextObject())) {
+				scavengeRememberedObject(env, objectPtr);
+			}
+		}
+	}
 }
 
 MMINLINE void
@@ -2763,7 +2964,7 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
 }
 
-/* NOTE - only  scavengeRememberedSetOverflow ends with a sync point.
+/* NOTE - only  scavengeRememberedSetOverflow contains sync points.
  * Callers of this function must not assume that there is a sync point
  */
 void
@@ -2878,9 +3079,24 @@ MM_Scavenger::reinitCache(MM_CopyScanCacheStandard *cache, void *base, void *top
 	cache->_arraySplitRememberedSlot = NULL;
 	cache->_hasPartiallyScannedObject = false;
 	cache->_shouldBeRemembered = false;
+	cache->_numaNode = 0;
 	cache->cacheTop = top;
 }
 
+MMINLINE uintptr_t
+MM_Scavenger::getNumaNodeForCopy(MM_EnvironmentStandard *env, void *addrBase)
+{
+	uintptr_t numaNode = 0;
+	if (0 != env->getNumaNode()) {
+		numaNode = _extensions->heapRegionManager->regionDescriptorForAddress(addrBase)->getNumaNode();
+		if ((0 == numaNode) || (UDATA_MAX == numaNode)) {
+			/* memory was not explicitly bound to a node; the copies are still warm in this thread's node */
+			numaNode = env->getNumaNode();
+		}
+	}
+	return numaNode;
+}
+
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getFreeCache(MM_EnvironmentStandard *env)
 {
@@ -3275,7 +3491,24 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard *env, GC_SlotObject *scann
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::getNextScanCacheFromList(MM_EnvironmentStandard *env)
 {
-	return _scavengeCacheScanList.popCache(env);
+	uintptr_t numaNode = env->getNumaNode();
+	if (0 == numaNode) {
+		return _scavengeCacheScanList.popCache(env);
+	}
+
+	/* Prefer scanning caches on the thread's own node, falling back to any cache rather than stalling */
+	MM_CopyScanCacheStandard *cache = _scavengeCacheScanList.popCacheOnNode(env, numaNode);
+	if (NULL == cache) {
+		cache = _scavengeCacheScanList.popCache(env);
+	}
+	if ((NULL != cache) && (0 != cache->_numaNode)) {
+		if (numaNode == cache->_numaNode) {
+			env->_scavengerStats._localNodeScanCacheCount += 1;
+		} else {
+			env->_scavengerStats._remoteNodeScanCacheCount += 1;
+		}
+	}
+	return cache;
 }
 
 /**
@@ -3558,6 +3791,42 @@ MM_Scavenger::fixupSlot(GC_SlotObject *slotObject)
 	return false;
 }
 
+uintptr_t
+MM_Scavenger::healObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
+{
+	uintptr_t healedSlots = 0;
+
+	/* Only heal while the concurrent phase is running - outside of it slots may be written non-atomically */
+	if (concurrent_state_scan == _concurrentState) {
+		bool const compressed = _extensions->compressObjectReferences();
+		uintptr_t copiedObjects = 0;
+		GC_SlotObject *slotObject = NULL;
+		GC_ObjectScannerState objectScannerState;
+		GC_ObjectScanner *objectScanner = getObjectScanner(env, objectPtr, (void *) &objectScannerState, GC_ObjectScanner::scanHeap);
+		if (NULL != objectScanner) {
+			while (NULL != (slotObject = objectScanner->getNextSlot())) {
+				omrobjectptr_t slotValue = slotObject->readReferenceFromSlot();
+				if (isObjectInEvacuateMemory(slotValue)) {
+					if (!MM_ForwardedHeader(slotValue, compressed).isForwardedPointer()) {
+						copiedObjects += 1;
+					}
+					copyAndForward(env, slotObject);
+					healedSlots += 1;
+				}
+			}
+		}
+
+		if (0 != healedSlots) {
+			MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+			MM_AtomicOperations::addU64(&scavengerStats->_readObjectBarrierHeal, 1);
+			MM_AtomicOperations::addU64(&scavengerStats->_readObjectBarrierUpdate, healedSlots);
+			MM_AtomicOperations::addU64(&scavengerStats->_readObjectBarrierCopy, copiedObjects);
+		}
+	}
+
+	return healedSlots;
+}
+
 void
 MM_Scavenger::fixupObjectScan(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr)
 {
@@ -3746,12 +4015,28 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 					}
 				}
 
-				/* ii) Walk old space and build up the overflow list */
+				/* ii) Walk old space and build up the overflow list, shared by all GC threads (see below) */
 				/* the list is built because after reverse fwd ptrs are installed, the heap becomes unwalkable */
 				clearRememberedSetLists(env);
 
 				MM_RSOverflow rememberedSetOverflow(env);
-				addAllRememberedObjectsToOverflow(env, &rememberedSetOverflow);
+				_rememberedSetOverflowMarkMap = rememberedSetOverflow.getMarkMap();
+				buildRememberedSetOverflowChunks(env);
+			}
+		}
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+
+	if (isRememberedSetInOverflowState() && !IS_CONCURRENT_ENABLED) {
+		MM_RSOverflow rememberedSetOverflow(env, _rememberedSetOverflowMarkMap);
+		addAllRememberedObjectsToOverflowParallel(env, &rememberedSetOverflow);
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		if(isRememberedSetInOverflowState()) {
+			if (!IS_CONCURRENT_ENABLED) {
+				freeRememberedSetOverflowChunks(env);
+				MM_RSOverflow rememberedSetOverflow(env, _rememberedSetOverflowMarkMap);
 
 				/*
 				 * 2.c)Walk the evacuate space, fixing up objects and installing reverse forward pointers in survivor space
@@ -3793,6 +4078,34 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 	}
 }
 
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+void
+MM_Scavenger::preZeroAllocateSpace(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_MemoryPool *memoryPool = _activeSubSpace->getMemorySubSpaceAllocate()->getMemoryPool();
+	MM_HeapLinkedFreeHeader *firstEntry = (MM_HeapLinkedFreeHeader *)memoryPool->getFirstFreeStartingAddr(env);
+
+	if (NULL != firstEntry) {
+		uint64_t startTime = omrtime_hires_clock();
+		MM_ParallelPreZeroTask preZeroTask(env, _dispatcher, memoryPool);
+		_dispatcher->run(env, &preZeroTask);
+
+		/* Free entries are address ordered - the last one bounds the zeroed range */
+		MM_HeapLinkedFreeHeader *lastEntry = firstEntry;
+		uintptr_t zeroedBytes = 0;
+		for (MM_HeapLinkedFreeHeader *freeEntry = firstEntry; NULL != freeEntry; freeEntry = (MM_HeapLinkedFreeHeader *)memoryPool->getNextFreeStartingAddr(env, freeEntry)) {
+			zeroedBytes += freeEntry->getSize();
+			lastEntry = freeEntry;
+		}
+		memoryPool->setPreZeroedRange(env, firstEntry, lastEntry->afterEnd());
+
+		Trc_MM_Scavenger_preZeroAllocateSpace(env->getLanguageVMThread(), firstEntry, lastEntry->afterEnd(), zeroedBytes,
+			preZeroTask.getThreadCount(), omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS));
+	}
+}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 /**
  * Setup, execute and complete a scavenge.
  */
@@ -3876,10 +4189,17 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 			/* Build free list in evacuate profile. Perform resize. */
 			_activeSubSpace->masterTeardownForSuccessfulGC(env);
 
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+			if (_extensions->scavengerPreZeroAllocateSpace && (0 != _extensions->batchClearTLH) && !_extensions->isConcurrentScavengerEnabled()) {
+				preZeroAllocateSpace(env);
+			}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
+
 			/* Defer to collector language interface */
 			_delegate.masterThreadGarbageCollect_scavengeSuccess(env);
 
-			if(_extensions->scvTenureStrategyAdaptive) {
+			/* The pause target controller has already set the adaptive tenure age in the resize above */
+			if(_extensions->scvTenureStrategyAdaptive && !_extensions->isScavengerPauseTargetEnabled()) {
 				/* Adjust the tenure age based on the percentage of new space used.  Also, avoid / by 0 */
 				uintptr_t newSpaceTotalSize = _activeSubSpace->getMemorySubSpaceAllocate()->getActiveMemorySize();
 				uintptr_t newSpaceConsumedSize = _extensions->scavengerStats._flipBytes;
@@ -4856,6 +5176,7 @@ MM_Scavenger::scavengeComplete(MM_EnvironmentBase *envBase)
 
 	MM_ConcurrentScavengeTask scavengeTask(env, _dispatcher, this, MM_ConcurrentScavengeTask::SCAVENGE_COMPLETE, env->_cycleState);
 	_dispatcher->run(env, &scavengeTask);
+	_extensions->scavengerStats._threadCount = scavengeTask.getThreadCount();
 
 	Assert_MM_true(_scavengeCacheFreeList.areAllCachesReturned());
 
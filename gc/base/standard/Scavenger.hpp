@@ -50,6 +50,7 @@ class MM_CollectorLanguageInterface;
 class MM_Dispatcher;
 class MM_EnvironmentBase;
 class MM_HeapRegionManager;
+class MM_MarkMap;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_MemorySubSpaceSemiSpace;
@@ -73,6 +74,9 @@ private:
 
 	const uintptr_t _objectAlignmentInBytes;	/**< Run-time objects alignment in bytes */
 	bool _isRememberedSetInOverflowAtTheBeginning; /**< Cached RS Overflow flag at the beginning of the scavenge */
+	MM_MarkMap *_rememberedSetOverflowMarkMap; /**< Mark map shared by GC threads to record remembered objects while scavenging RS Overflow */
+	void **_rememberedSetOverflowChunks; /**< Base and top of each Tenure chunk walked in parallel to find remembered objects, NULL if a region is walked as a whole */
+	uintptr_t _rememberedSetOverflowChunkCount; /**< Number of chunks in _rememberedSetOverflowChunks */
 
 	MM_GCExtensionsBase *_extensions;
 	
@@ -302,6 +306,15 @@ public:
 	
 	void deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t priorityFieldOffset1, uintptr_t priorityFieldOffset2);
 
+	/**
+	 * Dynamic breadth first scan ordering - copy the hot (leading) reference slots of a just copied object
+	 * ahead of scan order, so that they land in the copy cache next to their parent.
+	 * @param env The environment.
+	 * @param objectPtr The pointer to the just copied object.
+	 * @param depth Depth of objectPtr below the object whose slot triggered the hot slot copy (starting at 1)
+	 */
+	void copyHotSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t depth);
+
 	MMINLINE bool scavengeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
 	void scavengeRememberedSetList(MM_EnvironmentStandard *env);
 	void scavengeRememberedSetOverflow(MM_EnvironmentStandard *env);
@@ -389,6 +402,16 @@ public:
 	 */
 	MMINLINE void reinitCache(MM_CopyScanCacheStandard *cache, void *base, void *top);
 
+	/**
+	 * Determine the NUMA node a copy cache is local to, for NUMA aware gencon. This is the node the reserved memory
+	 * is bound to or, for memory with no binding (the flat nursery), the node of the copying thread, whose
+	 * processor caches hold the objects it has just copied.
+	 * @param env - current thread environment
+	 * @param addrBase base address of the reserved memory
+	 * @return the node (1-based), or 0 if the thread has no node
+	 */
+	MMINLINE uintptr_t getNumaNodeForCopy(MM_EnvironmentStandard *env, void *addrBase);
+
 	/**
 	 * An attempt to get a preallocated scan cache header, free list will be locked
 	 * @param env - current thread environment
@@ -462,11 +485,27 @@ public:
 	void rememberObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
 
 	/*
-	 * Scan Tenure and add all found Remembered objects to Overflow
+	 * Scan Tenure in parallel and add all found Remembered objects to Overflow.
+	 * Chunks built by buildRememberedSetOverflowChunks() are the work units, or whole regions if there are none.
+	 * Must be called by all GC threads of the current task.
+	 * @param env - Environment
+	 * @param overflow - pointer to RS Overflow sharing a mark map with the other GC threads
+	 */
+	void addAllRememberedObjectsToOverflowParallel(MM_EnvironmentStandard *env, MM_RSOverflow *overflow);
+
+	/*
+	 * Split Tenure into chunks of at least RS_OVERFLOW_SCAN_UNIT_SIZE bytes for addAllRememberedObjectsToOverflowParallel().
+	 * A chunk starts at the base of a region or at the end of a free entry, where an object is known to start
+	 * without walking the objects before it. Called by the master thread only.
+	 * @param env - Environment
+	 */
+	void buildRememberedSetOverflowChunks(MM_EnvironmentStandard *env);
+
+	/*
+	 * Free the chunks built by buildRememberedSetOverflowChunks(). Called by the master thread only.
 	 * @param env - Environment
-	 * @param overflow - pointer to RS Overflow
 	 */
-	void addAllRememberedObjectsToOverflow(MM_EnvironmentStandard *env, MM_RSOverflow *overflow);
+	void freeRememberedSetOverflowChunks(MM_EnvironmentStandard *env);
 
 	void clearRememberedSetLists(MM_EnvironmentStandard *env);
 
@@ -528,6 +567,13 @@ public:
 
 	void scavenge(MM_EnvironmentBase *env);
 	bool scavengeCompletedSuccessfully(MM_EnvironmentStandard *env);
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+	/**
+	 * Zero the free memory of the allocate space on the GC threads, so that TLH refreshes from it can skip clearing.
+	 * Called by the master thread after the free list of the allocate space has been rebuilt.
+	 */
+	void preZeroAllocateSpace(MM_EnvironmentBase *env);
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 	virtual	void masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap = false, bool rebuildMarkBits = false);
 
 	MMINLINE uintptr_t
@@ -692,6 +738,17 @@ public:
 	 * Enabled/disable approriate thread local resources when starting or finishing Concurrent Scavenger Cycle
 	 */ 
 	void switchConcurrentForThread(MM_EnvironmentBase *env);	
+
+	/**
+	 * Self-healing support for the read barrier slow path. Rather than copying and forwarding only
+	 * the referent of the slot that was loaded, copy and forward every evacuate referent held by the same object, so
+	 * that subsequent loads from that object take the fast path. Slots are updated atomically since mutators may be
+	 * storing to the same object concurrently.
+	 * @param[in] env Environment pointer for calling thread
+	 * @param[in] objectPtr Object holding the slot that triggered the read barrier
+	 * @return number of slots healed
+	 */
+	uintptr_t healObjectSlots(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
 	
 	void reportConcurrentScavengeStart(MM_EnvironmentStandard *env);
 	void reportConcurrentScavengeEnd(MM_EnvironmentStandard *env);
@@ -822,6 +879,9 @@ public:
 		, _delegate(env)
 		, _objectAlignmentInBytes(env->getObjectAlignmentInBytes())
 		, _isRememberedSetInOverflowAtTheBeginning(false)
+		, _rememberedSetOverflowMarkMap(NULL)
+		, _rememberedSetOverflowChunks(NULL)
+		, _rememberedSetOverflowChunkCount(0)
 		, _extensions(env->getExtensions())
 		, _dispatcher(_extensions->dispatcher)
 		, _doneIndex(0)
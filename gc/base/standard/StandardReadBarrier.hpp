@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#ifndef STANDARDREADBARRIER_HPP_
+#define STANDARDREADBARRIER_HPP_
+
+#include "objectdescription.h"
+
+#include "EnvironmentStandard.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Scavenger.hpp"
+#include "SlotObject.hpp"
+
+struct OMR_VMThread;
+
+/**
+ * Out-of-line read barrier. In the absence of other (equivalent inline) read barrier, this method must
+ * be called whenever a reference is loaded from a parent slot.
+ *
+ * To support the OMR concurrent scavenger, a load that finds a reference into evacuate space heals the
+ * parent object: every evacuate referent it holds is copied and forwarded, not only the one that was loaded.
+ *
+ * @param omrThread The thread loading the reference from the parent slot
+ * @param parentObject the parent object
+ * @param parentSlot Points to the slot in the parent object that holds the reference
+ * @see MM_Scavenger::healObjectSlots()
+ */
+MMINLINE void
+standardReadBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, fomrobject_t *parentSlot)
+{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isConcurrentScavengerInProgress()) {
+		GC_SlotObject slotObject(omrThread->_vm, parentSlot);
+		if (extensions->scavenger->isObjectInEvacuateMemory(slotObject.readReferenceFromSlot())) {
+			extensions->scavenger->healObjectSlots((MM_EnvironmentStandard *)env, parentObject);
+		}
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+}
+
+/**
+ * Convenience method to call out-of-line read barrier and load the reference held by a parent slot.
+ *
+ * @param omrThread The thread loading the reference from the parent slot
+ * @param parentObject the parent object
+ * @param parentSlot Points to the slot in the parent object that holds the reference
+ * @return the reference held by the parent slot
+ * @see standardReadBarrier(OMR_VMThread *, omrobjectptr_t, fomrobject_t *)
+ */
+MMINLINE omrobjectptr_t
+standardReadBarrierLoad(OMR_VMThread *omrThread, omrobjectptr_t parentObject, fomrobject_t *parentSlot)
+{
+	standardReadBarrier(omrThread, parentObject, parentSlot);
+
+	GC_SlotObject slotObject(omrThread->_vm, parentSlot);
+	return slotObject.readReferenceFromSlot();
+}
+
+/**
+ * Out-of-line read barrier for references held outside of the heap, in slots that the collector only
+ * updates at the end of a cycle (for example weak or clearable roots). If a concurrent scavenge is in
+ * progress and the slot refers to evacuate space, the referent is copied and forwarded and the slot updated.
+ *
+ * @param omrThread The thread loading the reference from the root slot
+ * @param rootSlot Points to the slot that holds the reference
+ * @return the reference held by the root slot
+ */
+MMINLINE omrobjectptr_t
+standardRootReadBarrierLoad(OMR_VMThread *omrThread, omrobjectptr_t *rootSlot)
+{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isConcurrentScavengerInProgress() && extensions->scavenger->isObjectInEvacuateMemory(*rootSlot)) {
+		extensions->scavenger->copyObjectSlot((MM_EnvironmentStandard *)env, (volatile omrobjectptr_t *)rootSlot);
+	}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+	return *rootSlot;
+}
+
+#endif /* STANDARDREADBARRIER_HPP_ */
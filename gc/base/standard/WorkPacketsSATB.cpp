@@ -26,6 +26,7 @@
 
 #include "WorkPacketsSATB.hpp"
 
+#include "AtomicOperations.hpp"
 #include "Debug.hpp"
 #include "GCExtensionsBase.hpp"
 #include "OverflowStandard.hpp"
@@ -188,6 +189,56 @@ MM_WorkPacketsSATB::moveInUseToNonEmpty(MM_EnvironmentBase *env)
 	}
 }
 
+/**
+ * Flush a full barrier packet for the collector to trace.
+ * Mutators flush concurrently, so rather than taking a full packet list lock the packet
+ * is pushed onto a lock-free stack which is drained by the collector in bulk.
+ * @param packet the full packet to flush
+ */
+void
+MM_WorkPacketsSATB::flushBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	_flushedBarrierPackets.push(packet);
+	MM_AtomicOperations::add(&_barrierPacketFlushCount, 1);
+}
+
+/**
+ * Detach all flushed barrier packets and move them to the full packet list so they
+ * are available for processing. The whole stack is detached at once, so the drain
+ * is not exposed to ABA races with mutators pushing concurrently.
+ * @return the number of packets drained
+ */
+uintptr_t
+MM_WorkPacketsSATB::drainFlushedBarrierPackets(MM_EnvironmentBase *env)
+{
+	MM_Packet *tail = NULL;
+	uintptr_t count = 0;
+	MM_Packet *head = _flushedBarrierPackets.popAll(&tail, &count);
+	if (NULL == head) {
+		return 0;
+	}
+
+	_fullPacketList.pushList(head, tail, count);
+	MM_AtomicOperations::add(&_barrierPacketDrainCount, 1);
+
+	/* Work was published - alert any threads waiting for input */
+	if (_inputListWaitCount > 0) {
+		notifyWaitingThreads(env);
+	}
+
+	return count;
+}
+
+/**
+ * Return all packets, including flushed barrier packets not yet drained, to the empty list.
+ */
+void
+MM_WorkPacketsSATB::resetAllPackets(MM_EnvironmentBase *env)
+{
+	drainFlushedBarrierPackets(env);
+	MM_WorkPackets::resetAllPackets(env);
+}
+
 /**
  * Return the heap capactify factor used to determine how many packets to create
  *
@@ -27,6 +27,7 @@
 #if defined(OMR_GC_REALTIME)
 
 #include "EnvironmentBase.hpp"
+#include "PacketStack.hpp"
 #include "WorkPackets.hpp"
 
 class MM_IncrementalOverflow;
@@ -35,6 +36,9 @@ class MM_WorkPacketsSATB : public MM_WorkPackets
 {
 protected:
 	MM_PacketList _inUseBarrierPacketList;  /**< List for packets currently being used for the remembered set*/
+	MM_PacketStack _flushedBarrierPackets; /**< Lock-free stack of full barrier packets pushed by mutators and drained by the collector */
+	volatile uintptr_t _barrierPacketFlushCount; /**< Number of full barrier packets flushed since the counters were last reset */
+	volatile uintptr_t _barrierPacketDrainCount; /**< Number of non-empty drains of the flushed barrier packets since the counters were last reset */
 
 public:
 	static MM_WorkPacketsSATB *newInstance(MM_EnvironmentBase *env);
@@ -54,12 +58,27 @@ public:
 
 	void moveInUseToNonEmpty(MM_EnvironmentBase *env);
 
+	void flushBarrierPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	uintptr_t drainFlushedBarrierPackets(MM_EnvironmentBase *env);
+	virtual void resetAllPackets(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getBarrierPacketFlushCount() { return _barrierPacketFlushCount; }
+	MMINLINE uintptr_t getBarrierPacketDrainCount() { return _barrierPacketDrainCount; }
+	MMINLINE void resetBarrierPacketCounts()
+	{
+		_barrierPacketFlushCount = 0;
+		_barrierPacketDrainCount = 0;
+	}
+
 	/**
 	 * Create a MM_WorkPacketsRealtime object.
 	 */
 	MM_WorkPacketsSATB(MM_EnvironmentBase *env) :
 		MM_WorkPackets(env)
 		, _inUseBarrierPacketList(NULL)
+		, _flushedBarrierPackets()
+		, _barrierPacketFlushCount(0)
+		, _barrierPacketDrainCount(0)
 	{
 		_typeId = __FUNCTION__;
 	};
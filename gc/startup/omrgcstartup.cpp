@@ -44,6 +44,7 @@
 #include "ObjectAllocationInterface.hpp"
 #include "ObjectModel.hpp"
 #include "ParallelDispatcher.hpp"
+#include "ParallelHeapPreTouchTask.hpp"
 #include "VerboseManager.hpp"
 
 /* ****************
@@ -221,6 +222,9 @@ OMR_GC_InitializeDispatcherThreads(OMR_VMThread* omrVMThread)
 	if (!extensions->dispatcher->startUpThreads()) {
 		extensions->dispatcher->shutDownThreads();
 		rc = OMR_ERROR_INTERNAL;
+	} else if (extensions->heapPreTouch) {
+		/* The initial heap was committed before there were GC threads to touch it */
+		MM_ParallelHeapPreTouchTask::preTouchCommittedHeap(MM_EnvironmentBase::getEnvironment(omrVMThread));
 	}
 
 	return rc;
@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "AllocationSiteStats.hpp"
+
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+
+MM_AllocationSiteStats *
+MM_AllocationSiteStats::newInstance(MM_EnvironmentBase *env, uint32_t topK)
+{
+	MM_AllocationSiteStats *allocationSiteStats = (MM_AllocationSiteStats *)env->getForge()->allocate(sizeof(MM_AllocationSiteStats), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+
+	if (NULL != allocationSiteStats) {
+		new(allocationSiteStats) MM_AllocationSiteStats(topK);
+		if (!allocationSiteStats->initialize(env)) {
+			allocationSiteStats->kill(env);
+			allocationSiteStats = NULL;
+		}
+	}
+
+	return allocationSiteStats;
+}
+
+void
+MM_AllocationSiteStats::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_AllocationSiteStats::initialize(MM_EnvironmentBase *env)
+{
+	if (!_lock.initialize(env, &env->getExtensions()->lnrlOptions, "MM_AllocationSiteStats:_lock")) {
+		return false;
+	}
+
+	/* To accurately report the top _topK sites, keep counts for 2x more and discard the lower half */
+	_spaceSavingSites = spaceSavingNew(env->getPortLibrary(), _topK * 2);
+
+	return (NULL != _spaceSavingSites);
+}
+
+void
+MM_AllocationSiteStats::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _spaceSavingSites) {
+		spaceSavingFree(_spaceSavingSites);
+		_spaceSavingSites = NULL;
+	}
+	_lock.tearDown();
+}
+
+void
+MM_AllocationSiteStats::update(MM_EnvironmentBase *env, uintptr_t allocationSite, uintptr_t sampledBytes)
+{
+	_lock.acquire();
+	spaceSavingUpdate(_spaceSavingSites, (void *)allocationSite, sampledBytes);
+	_sampleCount += 1;
+	_sampledBytes += sampledBytes;
+	_lock.release();
+}
+
+void
+MM_AllocationSiteStats::clear()
+{
+	_lock.acquire();
+	spaceSavingClear(_spaceSavingSites);
+	_sampleCount = 0;
+	_sampledBytes = 0;
+	_lock.release();
+}
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(ALLOCATIONSITESTATS_HPP_)
+#define ALLOCATIONSITESTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "spacesaving.h"
+
+#include "Base.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Keeps track of the allocation sites that allocate the most bytes, as estimated from the samples taken
+ * at TLH refresh (@see MM_GCExtensionsBase::allocationSamplingInterval). Samples of all threads go into
+ * one top-K table under a lock, which is taken once per sampling interval of allocation.
+ * The accessors are meant for reporting while mutators are stopped (exclusive VM access held).
+ */
+class MM_AllocationSiteStats : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	OMRSpaceSaving *_spaceSavingSites; /**< top-k-frequent table of sampled bytes keyed by allocation site token */
+	MM_LightweightNonReentrantLock _lock; /**< serializes updates from mutator threads */
+	uint32_t _topK; /**< number of sites reported */
+	uintptr_t _sampleCount; /**< samples taken since the last clear */
+	uintptr_t _sampledBytes; /**< bytes attributed by the samples taken since the last clear */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_AllocationSiteStats *newInstance(MM_EnvironmentBase *env, uint32_t topK);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Attribute sampled bytes to an allocation site.
+	 * @param allocationSite language-provided token of the site (0 if unknown)
+	 * @param sampledBytes bytes allocated by the thread since its previous sample
+	 */
+	void update(MM_EnvironmentBase *env, uintptr_t allocationSite, uintptr_t sampledBytes);
+
+	/**
+	 * Reset the table, so that the next report covers only the allocations sampled after this call.
+	 */
+	void clear();
+
+	MMINLINE uintptr_t getSampleCount() { return _sampleCount; }
+	MMINLINE uintptr_t getSampledBytes() { return _sampledBytes; }
+
+	/**
+	 * @return number of sites that can be reported, at most topK
+	 */
+	MMINLINE uintptr_t getSiteCount()
+	{
+		uintptr_t siteCount = spaceSavingGetCurSize(_spaceSavingSites);
+		return (siteCount < _topK) ? siteCount : _topK;
+	}
+
+	/**
+	 * @param k rank of the site, starting at 1 for the site with the most sampled bytes
+	 * @return token of the site at rank k
+	 */
+	MMINLINE uintptr_t getSite(uintptr_t k) { return (uintptr_t)spaceSavingGetKthMostFreq(_spaceSavingSites, k); }
+
+	/**
+	 * @param k rank of the site, starting at 1 for the site with the most sampled bytes
+	 * @return estimated bytes allocated by the site at rank k (an upper bound, as for any space saving count)
+	 */
+	MMINLINE uintptr_t getSiteBytes(uintptr_t k) { return spaceSavingGetKthMostFreqCount(_spaceSavingSites, k); }
+
+	MM_AllocationSiteStats(uint32_t topK)
+		: MM_Base()
+		, _spaceSavingSites(NULL)
+		, _topK(topK)
+		, _sampleCount(0)
+		, _sampledBytes(0)
+	{}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+};
+
+#endif /* ALLOCATIONSITESTATS_HPP_ */
@@ -34,6 +34,9 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhBatchedCount = 0;
+	_tlhRefreshCountBatched = 0;
+	_tlhRefreshCountPreZeroed = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	_arrayletLeafAllocationCount = 0;
@@ -57,6 +60,9 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhBatchedCount, stats->_tlhBatchedCount);
+	MM_AtomicOperations::add(&_tlhRefreshCountBatched, stats->_tlhRefreshCountBatched);
+	MM_AtomicOperations::add(&_tlhRefreshCountPreZeroed, stats->_tlhRefreshCountPreZeroed);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _tlhMaxAbandonedListSize;
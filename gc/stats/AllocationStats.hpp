@@ -41,6 +41,9 @@ public:
 	uintptr_t _tlhRequestedBytes; /**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; /**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhBatchedCount; /**< Number of TLHs carved out of batched fresh refreshes and cached for later reuse. */
+	uintptr_t _tlhRefreshCountBatched; /**< Number of fresh refreshes satisfied by TLHs carved out of earlier batched refreshes. */
+	uintptr_t _tlhRefreshCountPreZeroed; /**< Number of fresh refreshes from memory zeroed by the scavenger, which were not cleared again. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -84,6 +87,9 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhBatchedCount(0),
+		_tlhRefreshCountBatched(0),
+		_tlhRefreshCountPreZeroed(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
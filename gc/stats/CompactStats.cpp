@@ -40,6 +40,9 @@ MM_CompactStats::clear()
 	_movedBytes = 0;
 	
 	_fixupObjects = 0;
+	_evacuatedSubAreas = 0;
+	_fixupOnlySubAreas = 0;
+	_windowFragmentedBytes = 0;
 	_setupStartTime = 0;
 	_setupEndTime = 0;
 	_moveStartTime = 0;
@@ -56,6 +59,9 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	_movedObjects += statsToMerge->_movedObjects;
 	_movedBytes += statsToMerge->_movedBytes;
 	_fixupObjects += statsToMerge->_fixupObjects;
+	_evacuatedSubAreas += statsToMerge->_evacuatedSubAreas;
+	_fixupOnlySubAreas += statsToMerge->_fixupOnlySubAreas;
+	_windowFragmentedBytes += statsToMerge->_windowFragmentedBytes;
 	/* merging time intervals is a little different than just creating a total since the sum of two time intervals, for our uses, is their union (as opposed to the sum of two time spans, which is their sum) */
 	_setupStartTime = (0 == _setupStartTime) ? statsToMerge->_setupStartTime : OMR_MIN(_setupStartTime, statsToMerge->_setupStartTime);
 	_setupEndTime = OMR_MAX(_setupEndTime, statsToMerge->_setupEndTime);
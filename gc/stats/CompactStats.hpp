@@ -50,6 +50,9 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	uintptr_t _evacuatedSubAreas; /**< Sub areas an incremental compaction was allowed to evacuate */
+	uintptr_t _fixupOnlySubAreas; /**< Sub areas an incremental compaction only fixed up */
+	uintptr_t _windowFragmentedBytes; /**< Bytes in small free entries within the incremental compaction window */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
 	uint64_t _moveStartTime;
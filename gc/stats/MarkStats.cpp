@@ -35,6 +35,7 @@ MM_MarkStats::clear()
 	_objectsMarked = 0;
 	_objectsScanned = 0;
 	_bytesScanned = 0;
+	_objectsPipelined = 0;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_syncStallCount = 0;
@@ -50,6 +51,7 @@ MM_MarkStats::merge(MM_MarkStats *statsToMerge)
 	_objectsMarked += statsToMerge->_objectsMarked;
 	_objectsScanned += statsToMerge->_objectsScanned;
 	_bytesScanned += statsToMerge->_bytesScanned;
+	_objectsPipelined += statsToMerge->_objectsPipelined;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
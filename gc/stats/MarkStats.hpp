@@ -48,6 +48,7 @@ public:
 	uintptr_t _objectsMarked;  /**< The number of objects found through scanning during marking */
 	uintptr_t _objectsScanned;  /**< The number of objects popped and scanned during marking (e.g., non-base type arrays) */
 	uintptr_t _bytesScanned; /**< The number of bytes scanned by the owning thread (or globally) during marking */
+	uintptr_t _objectsPipelined; /**< The number of objects prefetched and scanned through the marking scan pipeline */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
@@ -108,6 +109,7 @@ public:
 		,_objectsMarked(0)
 		,_objectsScanned(0)
 		,_bytesScanned(0)
+		,_objectsPipelined(0)
 		,_startTime(0)
 		,_endTime(0)
 	{
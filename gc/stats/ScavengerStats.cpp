@@ -69,6 +69,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_avgTenureBytes(0)
 	,_avgTenureBytesDeviation(0)
 	,_tiltRatio(0)
+	,_threadCount(0)
 	,_nextScavengeWillPercolate(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)	
 	,_avgTenureLOABytes(0)
@@ -88,17 +89,26 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedTime(0)
 	,_leafObjectCount(0)
 	,_copy_cachesize_sum(0)
+	,_referentCopyCount(0)
+	,_referentAdjacentCopyCount(0)
+	,_hotSlotCopyCount(0)
+	,_crossNodeCopyCount(0)
+	,_crossNodeCopyBytes(0)
+	,_localNodeScanCacheCount(0)
+	,_remoteNodeScanCacheCount(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	,_readObjectBarrierCopy(0)
 	,_readObjectBarrierUpdate(0)
+	,_readObjectBarrierHeal(0)
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	,_flipHistoryNewIndex(0)
 {
 	memset(_flipHistory, 0, sizeof(_flipHistory));
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_survivalCensus, 0, sizeof(_survivalCensus));
 }
 
 struct MM_ScavengerStats::FlipHistory*
@@ -188,18 +198,29 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_tenureExpandedCount = 0;
 	_tenureExpandedTime = 0;
 
+	_referentCopyCount = 0;
+	_referentAdjacentCopyCount = 0;
+	_hotSlotCopyCount = 0;
+
+	_crossNodeCopyCount = 0;
+	_crossNodeCopyBytes = 0;
+	_localNodeScanCacheCount = 0;
+	_remoteNodeScanCacheCount = 0;
+
 	_slotsCopied = 0;
 	_slotsScanned = 0;
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	_readObjectBarrierCopy = 0;
 	_readObjectBarrierUpdate = 0;
+	_readObjectBarrierHeal = 0;
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	_leafObjectCount = 0;
 	_copy_cachesize_sum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
+	memset(_survivalCensus, 0, sizeof(_survivalCensus));
 }
 
 bool
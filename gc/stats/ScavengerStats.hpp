@@ -39,6 +39,14 @@ class MM_EnvironmentBase;
 
 #define SCAVENGER_FLIP_HISTORY_SIZE 16
 
+/* Maximum distance (in bytes) between a referring slot and the copy of its referent for the copy to count as adjacent */
+#define OMR_SCAVENGER_ADJACENT_COPY_DISTANCE 256
+
+/* Survival census size classes: class n counts objects of [2^(n+SHIFT), 2^(n+SHIFT+1)) bytes, the first and last classes are open ended */
+#define OMR_SCAVENGER_CENSUS_SIZE_CLASSES 16
+#define OMR_SCAVENGER_CENSUS_SIZE_CLASS_SHIFT 4
+#define OMR_SCAVENGER_CENSUS_AGES (OBJECT_HEADER_AGE_MAX+1)
+
 /**
  * Storage for statistics relevant to a scavenging (semi-space copying) collector.
  * @ingroup GC_Stats
@@ -106,6 +114,7 @@ public:
 	uintptr_t _avgTenureBytesDeviation; /**< The average, weighted deviation of the tenureBytes*/
 	
 	uintptr_t _tiltRatio;	/**< use to pass tiltRatio to verbose */
+	uintptr_t _threadCount;	/**< use to pass the number of GC threads the scavenge task ran with to verbose */
 
 	bool _nextScavengeWillPercolate;
 	
@@ -136,12 +145,24 @@ public:
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
 	uint64_t _copy_cachesize_sum;
 
+	uintptr_t _referentCopyCount; /**< The number of objects copied through a slot of a referring object */
+	uintptr_t _referentAdjacentCopyCount; /**< The number of objects copied within OMR_SCAVENGER_ADJACENT_COPY_DISTANCE of the referring slot */
+	uintptr_t _hotSlotCopyCount; /**< The number of objects copied ahead of scan order by dynamic breadth first hot slot copying */
+
+	uintptr_t _crossNodeCopyCount; /**< The number of objects copied into memory on a NUMA node other than the copying thread's */
+	uintptr_t _crossNodeCopyBytes; /**< The number of bytes copied into memory on a NUMA node other than the copying thread's */
+	uintptr_t _localNodeScanCacheCount; /**< The number of scan caches taken from the scan list that are on the scanning thread's NUMA node */
+	uintptr_t _remoteNodeScanCacheCount; /**< The number of scan caches taken from the scan list that are on another NUMA node */
+
+	uintptr_t _survivalCensus[OMR_SCAVENGER_CENSUS_AGES][OMR_SCAVENGER_CENSUS_SIZE_CLASSES]; /**< Bytes surviving the scavenge by age (before the scavenge) and size class, recorded only if scavengerSurvivalCensus is enabled */
+
 	uint64_t _slotsCopied; /**< The number of slots copied by the thread since _slotsScanned was last sampled and reset */
 	uint64_t _slotsScanned; /**< The number of slots scanned by the thread since _slotsCopied was last sampled and reset */
 	
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uint64_t _readObjectBarrierCopy; /**< Number of objects copied by read barrier */
 	uint64_t _readObjectBarrierUpdate; /**< Number of reference slots updates, which may be (often is) preceded by object copy */ 
+	uint64_t _readObjectBarrierHeal; /**< Number of objects whose slots were healed by read barrier */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 protected:
@@ -214,6 +235,58 @@ public:
 		}
 	}
 
+	/**
+	 * Count an object copied through a referring slot, and whether the copy landed next to that slot.
+	 * @param[in] slotAddr address of the referring slot
+	 * @param[in] copyAddr address of the copied referent
+	 */
+	MMINLINE void
+	countReferentCopy(uintptr_t slotAddr, uintptr_t copyAddr)
+	{
+		uintptr_t distance = (slotAddr < copyAddr) ? (copyAddr - slotAddr) : (slotAddr - copyAddr);
+		_referentCopyCount += 1;
+		if (distance <= OMR_SCAVENGER_ADJACENT_COPY_DISTANCE) {
+			_referentAdjacentCopyCount += 1;
+		}
+	}
+
+	/**
+	 * Record a surviving object in the survival census.
+	 * @param[in] age age of the object before it was copied
+	 * @param[in] sizeInBytes number of bytes the object occupies
+	 */
+	MMINLINE void
+	countSurvivor(uintptr_t age, uintptr_t sizeInBytes)
+	{
+		uintptr_t sizeClass = 0;
+		if (sizeInBytes >= ((uintptr_t)1 << OMR_SCAVENGER_CENSUS_SIZE_CLASS_SHIFT)) {
+			sizeClass = MM_Math::floorLog2(sizeInBytes) - OMR_SCAVENGER_CENSUS_SIZE_CLASS_SHIFT;
+			if (OMR_SCAVENGER_CENSUS_SIZE_CLASSES <= sizeClass) {
+				sizeClass = OMR_SCAVENGER_CENSUS_SIZE_CLASSES - 1;
+			}
+		}
+		_survivalCensus[age][sizeClass] += sizeInBytes;
+	}
+
+	/**
+	 * @param[in] sizeClass survival census size class
+	 * @return the smallest object size, in bytes, counted in the size class (objects smaller than this are counted in class 0)
+	 */
+	MMINLINE static uintptr_t
+	getSurvivalCensusSizeClassMinimum(uintptr_t sizeClass)
+	{
+		return (uintptr_t)1 << (sizeClass + OMR_SCAVENGER_CENSUS_SIZE_CLASS_SHIFT);
+	}
+
+	/**
+	 * @return fraction of objects copied through a referring slot that were copied next to that slot
+	 */
+	MMINLINE double
+	getReferentAdjacencyRatio()
+	{
+		return (0 == _referentCopyCount) ? 0.0 : ((double)_referentAdjacentCopyCount / (double)_referentCopyCount);
+	}
+
 	MMINLINE void
 	countCopyCacheSize(uint64_t copyCacheSize, uint64_t copyCacheSizeMax)
 	{
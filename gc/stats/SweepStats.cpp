@@ -39,6 +39,12 @@ MM_SweepStats::clear()
 	sweepHeapBytesTotal = 0;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	lazySweepPendingRegions = 0;
+	lazySweepAllocationSweptRegions = 0;
+	lazySweepCompletedRegions = 0;
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	idleTime = 0;
 	mergeTime = 0;
@@ -52,6 +52,12 @@ public:
 	uintptr_t sweepChunksProcessed;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t lazySweepPendingRegions; /**< Number of small regions this lazy sweep left for allocation to sweep */
+	uintptr_t lazySweepAllocationSweptRegions; /**< Number of small regions left by the previous lazy sweep that allocation swept */
+	uintptr_t lazySweepCompletedRegions; /**< Number of small regions left by the previous lazy sweep that were swept before marking */
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 	uint64_t _startTime;	/**< Sweep start time */
 	uint64_t _endTime;		/**< Sweep end time */
 
@@ -47,6 +47,8 @@ public:
 	uintptr_t workPacketsAcquired;
 	uintptr_t workPacketsReleased;
 	uintptr_t workPacketsExchanged; /**< The number of output packets converted into input packets without being returned to the shared pool first */
+	uintptr_t workPacketStealAttempts; /**< The number of times the thread tried to steal a packet from a non-empty work-stealing deque of another thread */
+	uintptr_t workPacketsStolen; /**< The number of packets the thread successfully stole from work-stealing deques of other threads */
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
@@ -73,6 +75,8 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		workPacketStealAttempts = 0;
+		workPacketsStolen = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +95,8 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		workPacketStealAttempts += statsToMerge->workPacketStealAttempts;
+		workPacketsStolen += statsToMerge->workPacketsStolen;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -147,6 +153,8 @@ public:
 		,workPacketsAcquired(0)
 		,workPacketsReleased(0)
 		,workPacketsExchanged(0)
+		,workPacketStealAttempts(0)
+		,workPacketsStolen(0)
 		,_workStallCount(0)
 		,_completeStallCount(0)
 		,_workStallTime(0)
@@ -0,0 +1,205 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEEVENTCONVERTER_HPP_)
+#define VERBOSEEVENTCONVERTER_HPP_
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "VerboseEventRecord.hpp"
+
+#define VERBOSE_EVENT_CONVERTER_HEADER "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n\n"
+#define VERBOSE_EVENT_CONVERTER_FOOTER "</verbosegc>\n"
+#define VERBOSE_EVENT_CONVERTER_DATE_FORMAT_PRE_MS "%Y-%m-%dT%H:%M:%S."
+
+/**
+ * Regenerates verbose GC XML from a binary event stream written by MM_VerboseEventStream.
+ * Shared by the verbosegcconvert tool and gctest, so like VerboseEventRecord.hpp it must not depend on any GC headers.
+ *
+ * Only the stanzas carried by the binary records are produced (exclusive-start/end, cycle-start/end and
+ * gc-start/end with their mem-info). Stanza ids are renumbered from 1 in the order the handler would have
+ * assigned them.
+ */
+class MM_VerboseEventConverter
+{
+public:
+	typedef enum {
+		CONVERTED = 0,
+		NOT_BINARY_LOG,
+		UNSUPPORTED_VERSION
+	} Result;
+
+	/**
+	 * Read the stream header from a binary log and check that its records can be converted.
+	 * @param in[in] binary log, positioned at its start
+	 * @param header[out] the header read
+	 * @return CONVERTED if the records that follow can be converted
+	 */
+	static Result
+	readHeader(FILE *in, VerboseEventStreamHeader *header)
+	{
+		if ((1 != fread(header, sizeof(*header), 1, in))
+			|| (0 != memcmp(header->eyecatcher, VERBOSE_EVENT_STREAM_EYECATCHER, sizeof(header->eyecatcher)))
+		) {
+			return NOT_BINARY_LOG;
+		}
+		if ((VERBOSE_EVENT_STREAM_VERSION != header->version) || (sizeof(VerboseEventRecord) != header->recordSize)) {
+			return UNSUPPORTED_VERSION;
+		}
+		header->gcVersion[sizeof(header->gcVersion) - 1] = '\0';
+		return CONVERTED;
+	}
+
+	/**
+	 * Convert a whole binary log into a verbosegc XML document.
+	 * @param in[in] binary log, positioned at its start
+	 * @param out[in] destination of the XML document, nothing is written unless the header is accepted
+	 * @param header[out] the header read
+	 * @return the result of readHeader
+	 */
+	static Result
+	convert(FILE *in, FILE *out, VerboseEventStreamHeader *header)
+	{
+		Result result = readHeader(in, header);
+		if (CONVERTED == result) {
+			fprintf(out, VERBOSE_EVENT_CONVERTER_HEADER, header->gcVersion);
+
+			uint64_t nextId = 1;
+			uint64_t contextId = 0;
+			VerboseEventRecord record;
+			while (1 == fread(&record, sizeof(record), 1, in)) {
+				convertRecord(out, &record, &nextId, &contextId);
+			}
+
+			fprintf(out, VERBOSE_EVENT_CONVERTER_FOOTER);
+		}
+		return result;
+	}
+
+private:
+	/* OMR_GC_CYCLE_TYPE_* values, see omrgcconsts.h */
+	static const char *
+	getCycleType(uint32_t type)
+	{
+		const char *cycleType = NULL;
+		switch (type) {
+		case 0:
+			cycleType = "default";
+			break;
+		case 1:
+			cycleType = "global";
+			break;
+		case 2:
+			cycleType = "scavenge";
+			break;
+		case 6:
+			cycleType = "epsilon";
+			break;
+		default:
+			cycleType = "unknown";
+			break;
+		}
+		return cycleType;
+	}
+
+	static void
+	formatTimestamp(char *buf, size_t bufLen, uint64_t wallTimeMs)
+	{
+		time_t seconds = (time_t)(wallTimeMs / 1000);
+		struct tm *localTime = localtime(&seconds);
+		size_t length = 0;
+		if (NULL != localTime) {
+			length = strftime(buf, bufLen, VERBOSE_EVENT_CONVERTER_DATE_FORMAT_PRE_MS, localTime);
+		}
+		snprintf(buf + length, bufLen - length, "%03llu", (unsigned long long)(wallTimeMs % 1000));
+	}
+
+	static unsigned long long
+	percentFree(uint64_t freeMemory, uint64_t totalMemory)
+	{
+		return (0 == totalMemory) ? 0 : (unsigned long long)((freeMemory * 100) / totalMemory);
+	}
+
+	static void
+	convertRecord(FILE *out, const VerboseEventRecord *record, uint64_t *nextId, uint64_t *contextId)
+	{
+		/* matches the %p formatting of omrstr_printf */
+		const int pointerWidth = (int)(2 * sizeof(void *));
+		char timestamp[64];
+		formatTimestamp(timestamp, sizeof(timestamp), record->wallTimeMs);
+		const uint64_t *data = record->data;
+		const char *cycleType = getCycleType(record->cycleType);
+
+		switch (record->type) {
+		case VERBOSE_EVENT_EXCLUSIVE_START:
+			fprintf(out, "<exclusive-start id=\"%llu\" timestamp=\"%s\" intervalms=\"%llu.%03llu\">\n",
+					(unsigned long long)(*nextId)++, timestamp, (unsigned long long)(data[0] / 1000), (unsigned long long)(data[0] % 1000));
+			fprintf(out, "  <response-info timems=\"%llu.%03llu\" idlems=\"%llu.%03llu\" threads=\"%llu\" lastid=\"%0*llX\" lastname=\"OMR_VMThread [%0*llX]\" />\n",
+					(unsigned long long)(data[1] / 1000), (unsigned long long)(data[1] % 1000),
+					(unsigned long long)(data[2] / 1000), (unsigned long long)(data[2] % 1000),
+					(unsigned long long)data[3], pointerWidth, (unsigned long long)data[4], pointerWidth, (unsigned long long)data[5]);
+			fprintf(out, "</exclusive-start>\n");
+			break;
+		case VERBOSE_EVENT_EXCLUSIVE_END:
+			fprintf(out, "<exclusive-end id=\"%llu\" timestamp=\"%s\" durationms=\"%llu.%03llu\" />\n\n",
+					(unsigned long long)(*nextId)++, timestamp, (unsigned long long)(data[0] / 1000), (unsigned long long)(data[0] % 1000));
+			break;
+		case VERBOSE_EVENT_CYCLE_START:
+			*contextId = (*nextId)++;
+			fprintf(out, "<cycle-start id=\"%llu\" type=\"%s\" contextid=\"0\" timestamp=\"%s\" intervalms=\"%llu.%03llu\" />\n",
+					(unsigned long long)*contextId, cycleType, timestamp, (unsigned long long)(data[0] / 1000), (unsigned long long)(data[0] % 1000));
+			break;
+		case VERBOSE_EVENT_CYCLE_END:
+			fprintf(out, "<cycle-end id=\"%llu\" type=\"%s\" contextid=\"%llu\" timestamp=\"%s\" />\n",
+					(unsigned long long)(*nextId)++, cycleType, (unsigned long long)*contextId, timestamp);
+			break;
+		case VERBOSE_EVENT_GC_START:
+			fprintf(out, "<gc-start id=\"%llu\" type=\"%s\" contextid=\"%llu\" timestamp=\"%s\">\n",
+					(unsigned long long)(*nextId)++, cycleType, (unsigned long long)*contextId, timestamp);
+			fprintf(out, "  <mem-info id=\"%llu\" free=\"%llu\" total=\"%llu\" percent=\"%llu\" />\n",
+					(unsigned long long)(*nextId)++, (unsigned long long)data[0], (unsigned long long)data[1], percentFree(data[0], data[1]));
+			fprintf(out, "</gc-start>\n");
+			break;
+		case VERBOSE_EVENT_GC_END:
+			fprintf(out, "<gc-end id=\"%llu\" type=\"%s\" contextid=\"%llu\" durationms=\"%llu.%03llu\" usertimems=\"%llu.%03llu\" systemtimems=\"%llu.%03llu\" timestamp=\"%s\" activeThreads=\"%llu\">\n",
+					(unsigned long long)(*nextId)++, cycleType, (unsigned long long)*contextId,
+					(unsigned long long)(data[0] / 1000), (unsigned long long)(data[0] % 1000),
+					(unsigned long long)(data[1] / 1000), (unsigned long long)(data[1] % 1000),
+					(unsigned long long)(data[2] / 1000), (unsigned long long)(data[2] % 1000),
+					timestamp, (unsigned long long)data[5]);
+			fprintf(out, "  <mem-info id=\"%llu\" free=\"%llu\" total=\"%llu\" percent=\"%llu\" />\n",
+					(unsigned long long)(*nextId)++, (unsigned long long)data[3], (unsigned long long)data[4], percentFree(data[3], data[4]));
+			fprintf(out, "</gc-end>\n");
+			break;
+		case VERBOSE_EVENT_DROPPED:
+			fprintf(out, "<warning details=\"%llu verbose events were dropped, the binary event stream could not keep up\" />\n", (unsigned long long)data[0]);
+			break;
+		default:
+			fprintf(out, "<warning details=\"unknown binary event record type %u\" />\n", record->type);
+			break;
+		}
+	}
+};
+
+#endif /* VERBOSEEVENTCONVERTER_HPP_ */
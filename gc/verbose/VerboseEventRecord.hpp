@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEEVENTRECORD_HPP_)
+#define VERBOSEEVENTRECORD_HPP_
+
+#include <stdint.h>
+
+/*
+ * Layout of the binary verbose GC event stream written by MM_VerboseEventStream and read back by
+ * the verbosegcconvert tool. It is shared with the tool, so it must not depend on any GC headers
+ * and every field is fixed width. Bump VERBOSE_EVENT_STREAM_VERSION on any layout change.
+ */
+
+#define VERBOSE_EVENT_STREAM_EYECATCHER "OMRVGCB"
+#define VERBOSE_EVENT_STREAM_VERSION 1
+#define VERBOSE_EVENT_STREAM_GC_VERSION_LENGTH 64
+#define VERBOSE_EVENT_RECORD_DATA_COUNT 6
+
+/**
+ * Record types and the meaning of VerboseEventRecord::data for each of them.
+ * Times are in microseconds.
+ */
+typedef enum {
+	VERBOSE_EVENT_EXCLUSIVE_START = 1, /**< interval since last exclusive start, response time, mean idle time, halted threads, last responder language thread, last responder OMR_VMThread */
+	VERBOSE_EVENT_EXCLUSIVE_END = 2, /**< exclusive access duration */
+	VERBOSE_EVENT_CYCLE_START = 3, /**< interval since last cycle start of the same type */
+	VERBOSE_EVENT_CYCLE_END = 4, /**< no data */
+	VERBOSE_EVENT_GC_START = 5, /**< free heap bytes, total heap bytes */
+	VERBOSE_EVENT_GC_END = 6, /**< duration, user time, system time, free heap bytes, total heap bytes, active GC threads */
+	VERBOSE_EVENT_DROPPED = 7 /**< number of records dropped because the ring buffer was full */
+} VerboseEventType;
+
+/**
+ * Written once at the start of the stream.
+ */
+typedef struct VerboseEventStreamHeader {
+	char eyecatcher[8]; /**< VERBOSE_EVENT_STREAM_EYECATCHER */
+	uint32_t version; /**< VERBOSE_EVENT_STREAM_VERSION */
+	uint32_t recordSize; /**< sizeof(VerboseEventRecord) */
+	char gcVersion[VERBOSE_EVENT_STREAM_GC_VERSION_LENGTH]; /**< version reported in the verbosegc XML root element */
+} VerboseEventStreamHeader;
+
+/**
+ * One fixed-size record per GC phase or increment boundary.
+ */
+typedef struct VerboseEventRecord {
+	uint32_t type; /**< VerboseEventType */
+	uint32_t cycleType; /**< OMR_GC_CYCLE_TYPE_* of the current cycle, 0 for exclusive access records */
+	uint64_t wallTimeMs; /**< wall clock time the event was reported at */
+	uint64_t data[VERBOSE_EVENT_RECORD_DATA_COUNT]; /**< type specific payload, see VerboseEventType */
+} VerboseEventRecord;
+
+#endif /* VERBOSEEVENTRECORD_HPP_ */
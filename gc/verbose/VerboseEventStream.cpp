@@ -0,0 +1,520 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrutil.h"
+#include "mmhook_common.h"
+#include "modronapicore.hpp"
+
+#include <string.h>
+
+#include "VerboseEventStream.hpp"
+
+#include "AtomicOperations.hpp"
+#include "CollectionStatistics.hpp"
+#include "CycleState.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Dispatcher.hpp"
+#include "VerboseManager.hpp"
+
+static void verboseEventStreamExclusiveStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventStreamExclusiveEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventStreamCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventStreamCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventStreamGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseEventStreamGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+
+MM_VerboseEventStream::MM_VerboseEventStream(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	: MM_Base()
+	, _extensions(env->getExtensions())
+	, _omrVM(env->getOmrVM())
+	, _manager(manager)
+	, _mmPrivateHooks(NULL)
+	, _mmOmrHooks(NULL)
+	, _logFileDescriptor(-1)
+	, _records(NULL)
+	, _sequences(NULL)
+	, _enqueuePosition(0)
+	, _dequeuePosition(0)
+	, _droppedRecords(0)
+	, _flusherMonitor(NULL)
+	, _flusherState(STATE_ERROR)
+{
+}
+
+/**
+ * Create a new MM_VerboseEventStream instance writing to the given file.
+ * @return Pointer to the new MM_VerboseEventStream, or NULL if the file or the flusher thread could not be created.
+ */
+MM_VerboseEventStream *
+MM_VerboseEventStream::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, const char *filename)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	MM_VerboseEventStream *stream = (MM_VerboseEventStream *)extensions->getForge()->allocate(sizeof(MM_VerboseEventStream), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != stream) {
+		new(stream) MM_VerboseEventStream(env, manager);
+		if (!stream->initialize(env, filename)) {
+			stream->kill(env);
+			stream = NULL;
+		}
+	}
+	return stream;
+}
+
+void
+MM_VerboseEventStream::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getExtensions()->getForge()->free(this);
+}
+
+bool
+MM_VerboseEventStream::initialize(MM_EnvironmentBase *env, const char *filename)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	MM_Forge *forge = _extensions->getForge();
+
+	_mmPrivateHooks = J9_HOOK_INTERFACE(_extensions->privateHookInterface);
+	_mmOmrHooks = J9_HOOK_INTERFACE(_extensions->omrHookInterface);
+
+	_records = (VerboseEventRecord *)forge->allocate(sizeof(VerboseEventRecord) * VERBOSE_EVENT_STREAM_RING_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	_sequences = (volatile uintptr_t *)forge->allocate(sizeof(uintptr_t) * VERBOSE_EVENT_STREAM_RING_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if ((NULL == _records) || (NULL == _sequences)) {
+		return false;
+	}
+	/* slot i is free for the producer claiming position i */
+	for (uintptr_t i = 0; i < VERBOSE_EVENT_STREAM_RING_SIZE; i++) {
+		_sequences[i] = i;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&_flusherMonitor, 0, "MM_VerboseEventStream::_flusherMonitor")) {
+		return false;
+	}
+
+	_logFileDescriptor = omrfile_open(filename, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == _logFileDescriptor) {
+		_manager->handleFileOpenError(env, (char *)filename);
+		return false;
+	}
+
+	VerboseEventStreamHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.eyecatcher, VERBOSE_EVENT_STREAM_EYECATCHER, sizeof(header.eyecatcher));
+	header.version = VERBOSE_EVENT_STREAM_VERSION;
+	header.recordSize = sizeof(VerboseEventRecord);
+	strncpy(header.gcVersion, omrgc_get_version(_omrVM), sizeof(header.gcVersion) - 1);
+	if ((intptr_t)sizeof(header) != omrfile_write(_logFileDescriptor, &header, sizeof(header))) {
+		return false;
+	}
+
+	return startFlusher();
+}
+
+void
+MM_VerboseEventStream::tearDown(MM_EnvironmentBase *env)
+{
+	MM_Forge *forge = _extensions->getForge();
+
+	closeStream(env);
+
+	if (NULL != _flusherMonitor) {
+		omrthread_monitor_destroy(_flusherMonitor);
+		_flusherMonitor = NULL;
+	}
+	if (NULL != _sequences) {
+		forge->free((void *)_sequences);
+		_sequences = NULL;
+	}
+	if (NULL != _records) {
+		forge->free(_records);
+		_records = NULL;
+	}
+}
+
+void
+MM_VerboseEventStream::closeStream(MM_EnvironmentBase *env)
+{
+	if (isActive()) {
+		OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+		stopFlusher();
+		/* pick up anything published while the flusher was exiting */
+		drain();
+		omrfile_close(_logFileDescriptor);
+		_logFileDescriptor = -1;
+	}
+}
+
+void
+MM_VerboseEventStream::enableVerbose()
+{
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, verboseEventStreamExclusiveStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, verboseEventStreamExclusiveEnd, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, verboseEventStreamCycleStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, verboseEventStreamCycleEnd, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, verboseEventStreamGCStart, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, verboseEventStreamGCEnd, OMR_GET_CALLSITE(), (void *)this);
+}
+
+void
+MM_VerboseEventStream::disableVerbose()
+{
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_ACQUIRE, verboseEventStreamExclusiveStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_EXCLUSIVE_ACCESS_RELEASE, verboseEventStreamExclusiveEnd, NULL);
+	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_GC_CYCLE_START, verboseEventStreamCycleStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_POST_CYCLE_END, verboseEventStreamCycleEnd, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_START, verboseEventStreamGCStart, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_GC_INCREMENT_END, verboseEventStreamGCEnd, NULL);
+}
+
+int J9THREAD_PROC
+MM_VerboseEventStream::flusherThreadProc(void *info)
+{
+	MM_VerboseEventStream *stream = (MM_VerboseEventStream *)info;
+	stream->flusherThreadEntryPoint();
+	return 0;
+}
+
+bool
+MM_VerboseEventStream::startFlusher()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it can not report its state before we wait */
+	omrthread_monitor_enter(_flusherMonitor);
+	_flusherState = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		flusherThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _flusherState) {
+			omrthread_monitor_wait(_flusherMonitor);
+		}
+		success = (STATE_RUNNING == _flusherState);
+	} else {
+		_flusherState = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_flusherMonitor);
+
+	return success;
+}
+
+void
+MM_VerboseEventStream::stopFlusher()
+{
+	omrthread_monitor_enter(_flusherMonitor);
+	if (STATE_RUNNING == _flusherState) {
+		while (STATE_TERMINATED != _flusherState) {
+			_flusherState = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify(_flusherMonitor);
+			omrthread_monitor_wait(_flusherMonitor);
+		}
+	}
+	omrthread_monitor_exit(_flusherMonitor);
+}
+
+void
+MM_VerboseEventStream::flusherThreadEntryPoint()
+{
+	omrthread_monitor_enter(_flusherMonitor);
+	_flusherState = STATE_RUNNING;
+	omrthread_monitor_notify(_flusherMonitor);
+	while (STATE_TERMINATION_REQUESTED != _flusherState) {
+		omrthread_monitor_exit(_flusherMonitor);
+		drain();
+		omrthread_monitor_enter(_flusherMonitor);
+		if (STATE_TERMINATION_REQUESTED != _flusherState) {
+			/* producers never notify, so poll the ring at a fixed period */
+			omrthread_monitor_wait_timed(_flusherMonitor, VERBOSE_EVENT_STREAM_FLUSH_INTERVAL_MS, 0);
+		}
+	}
+	omrthread_monitor_exit(_flusherMonitor);
+
+	drain();
+
+	omrthread_monitor_enter(_flusherMonitor);
+	_flusherState = STATE_TERMINATED;
+	omrthread_monitor_notify(_flusherMonitor);
+	omrthread_exit(_flusherMonitor);
+}
+
+void
+MM_VerboseEventStream::drain()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	uintptr_t batchCount = 0;
+
+	for (;;) {
+		uintptr_t slot = _dequeuePosition & (VERBOSE_EVENT_STREAM_RING_SIZE - 1);
+		/* the producer publishes the slot by advancing its sequence past the claimed position */
+		if ((_dequeuePosition + 1) != _sequences[slot]) {
+			break;
+		}
+		MM_AtomicOperations::loadSync();
+		_writeBuffer[batchCount] = _records[slot];
+		batchCount += 1;
+		MM_AtomicOperations::storeSync();
+		/* hand the slot back to the producer claiming it one lap later */
+		_sequences[slot] = _dequeuePosition + VERBOSE_EVENT_STREAM_RING_SIZE;
+		_dequeuePosition += 1;
+
+		if (VERBOSE_EVENT_STREAM_WRITE_BATCH == batchCount) {
+			omrfile_write(_logFileDescriptor, _writeBuffer, sizeof(VerboseEventRecord) * batchCount);
+			batchCount = 0;
+		}
+	}
+
+	uintptr_t droppedRecords = _droppedRecords;
+	while ((0 != droppedRecords) && (droppedRecords != MM_AtomicOperations::lockCompareExchange(&_droppedRecords, droppedRecords, 0))) {
+		droppedRecords = _droppedRecords;
+	}
+	if (0 != droppedRecords) {
+		/* full batches were written out above, so there is always room for one more record */
+		VerboseEventRecord *record = &_writeBuffer[batchCount];
+		initRecord(record, VERBOSE_EVENT_DROPPED, 0);
+		record->data[0] = droppedRecords;
+		batchCount += 1;
+	}
+
+	if (0 != batchCount) {
+		omrfile_write(_logFileDescriptor, _writeBuffer, sizeof(VerboseEventRecord) * batchCount);
+	}
+}
+
+void
+MM_VerboseEventStream::publish(VerboseEventRecord *record)
+{
+	uintptr_t position = _enqueuePosition;
+	for (;;) {
+		uintptr_t slot = position & (VERBOSE_EVENT_STREAM_RING_SIZE - 1);
+		intptr_t lap = (intptr_t)(_sequences[slot] - position);
+		if (0 == lap) {
+			/* the slot is free for this position, try to claim it */
+			uintptr_t claimed = MM_AtomicOperations::lockCompareExchange(&_enqueuePosition, position, position + 1);
+			if (claimed == position) {
+				_records[slot] = *record;
+				MM_AtomicOperations::storeSync();
+				_sequences[slot] = position + 1;
+				break;
+			}
+			position = claimed;
+		} else if (0 > lap) {
+			/* the flusher has not written out this slot from the previous lap yet */
+			MM_AtomicOperations::add(&_droppedRecords, 1);
+			break;
+		} else {
+			/* another producer claimed this position */
+			position = _enqueuePosition;
+		}
+	}
+}
+
+void
+MM_VerboseEventStream::initRecord(VerboseEventRecord *record, VerboseEventType type, uintptr_t cycleType)
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+	memset(record, 0, sizeof(VerboseEventRecord));
+	record->type = (uint32_t)type;
+	record->cycleType = (uint32_t)cycleType;
+	record->wallTimeMs = (uint64_t)omrtime_current_time_millis();
+}
+
+bool
+MM_VerboseEventStream::getTimeDeltaInMicroSeconds(uint64_t *timeInMicroSeconds, uint64_t startTime, uint64_t endTime)
+{
+	if (endTime < startTime) {
+		*timeInMicroSeconds = 0;
+		return false;
+	}
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+
+	*timeInMicroSeconds = omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	return true;
+}
+
+void
+MM_VerboseEventStream::handleExclusiveStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_ExclusiveAccessAcquireEvent* event = (MM_ExclusiveAccessAcquireEvent*)eventData;
+	OMRPORT_ACCESS_FROM_OMRVM(_omrVM);
+
+	uint64_t currentTime = event->timestamp;
+	uint64_t previousTime = _manager->getLastExclusiveAccessStartTime();
+	if (0 == previousTime) {
+		previousTime = _manager->getInitializedTime();
+	}
+	uint64_t deltaTime = 0;
+	getTimeDeltaInMicroSeconds(&deltaTime, previousTime, currentTime);
+	_manager->setLastExclusiveAccessStartTime(currentTime);
+
+	OMR_VMThread* lastResponder = event->lastResponder;
+	VerboseEventRecord record;
+	initRecord(&record, VERBOSE_EVENT_EXCLUSIVE_START, 0);
+	record.data[0] = deltaTime;
+	record.data[1] = omrtime_hires_delta(0, event->exclusiveAccessTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	record.data[2] = omrtime_hires_delta(0, event->meanIdleTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	record.data[3] = event->haltedThreads;
+	record.data[4] = (uintptr_t)(NULL == lastResponder ? NULL : lastResponder->_language_vmthread);
+	record.data[5] = (uintptr_t)lastResponder;
+	publish(&record);
+}
+
+void
+MM_VerboseEventStream::handleExclusiveEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_ExclusiveAccessReleaseEvent* event = (MM_ExclusiveAccessReleaseEvent*)eventData;
+
+	uint64_t currentTime = event->timestamp;
+	uint64_t deltaTime = 0;
+	getTimeDeltaInMicroSeconds(&deltaTime, _manager->getLastExclusiveAccessStartTime(), currentTime);
+	_manager->setLastExclusiveAccessEndTime(currentTime);
+
+	VerboseEventRecord record;
+	initRecord(&record, VERBOSE_EVENT_EXCLUSIVE_END, 0);
+	record.data[0] = deltaTime;
+	publish(&record);
+}
+
+void
+MM_VerboseEventStream::handleCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCCycleStartEvent* event = (MM_GCCycleStartEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->omrVMThread);
+	uintptr_t cycleType = env->_cycleState->_type;
+
+	uint64_t currentTime = event->timestamp;
+	uint64_t previousTime = 0;
+	switch (cycleType) {
+	case OMR_GC_CYCLE_TYPE_GLOBAL:
+		previousTime = _manager->getLastGlobalGCTime();
+		_manager->setLastGlobalGCTime(currentTime);
+		break;
+	case OMR_GC_CYCLE_TYPE_SCAVENGE:
+		previousTime = _manager->getLastLocalGCTime();
+		_manager->setLastLocalGCTime(currentTime);
+		break;
+	default:
+		break;
+	}
+	if (0 == previousTime) {
+		previousTime = _manager->getInitializedTime();
+	}
+	uint64_t deltaTime = 0;
+	getTimeDeltaInMicroSeconds(&deltaTime, previousTime, currentTime);
+
+	VerboseEventRecord record;
+	initRecord(&record, VERBOSE_EVENT_CYCLE_START, cycleType);
+	record.data[0] = deltaTime;
+	publish(&record);
+}
+
+void
+MM_VerboseEventStream::handleCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCPostCycleEndEvent* event = (MM_GCPostCycleEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	VerboseEventRecord record;
+	initRecord(&record, VERBOSE_EVENT_CYCLE_END, env->_cycleState->_type);
+	publish(&record);
+}
+
+void
+MM_VerboseEventStream::handleGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCIncrementStartEvent* event = (MM_GCIncrementStartEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_CollectionStatistics *stats = (MM_CollectionStatistics *)event->stats;
+
+	VerboseEventRecord record;
+	initRecord(&record, VERBOSE_EVENT_GC_START, env->_cycleState->_type);
+	record.data[0] = stats->_totalFreeHeapSize;
+	record.data[1] = stats->_totalHeapSize;
+	publish(&record);
+}
+
+void
+MM_VerboseEventStream::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_GCIncrementEndEvent* event = (MM_GCIncrementEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_CollectionStatistics *stats = (MM_CollectionStatistics *)event->stats;
+
+	/* process times are reported in nanoseconds */
+	uint64_t startUserTime = (uint64_t)stats->_startProcessTimes._userTime / 1000;
+	uint64_t startSystemTime = (uint64_t)stats->_startProcessTimes._systemTime / 1000;
+	uint64_t endUserTime = (uint64_t)stats->_endProcessTimes._userTime / 1000;
+	uint64_t endSystemTime = (uint64_t)stats->_endProcessTimes._systemTime / 1000;
+
+	VerboseEventRecord record;
+	initRecord(&record, VERBOSE_EVENT_GC_END, env->_cycleState->_type);
+	getTimeDeltaInMicroSeconds(&record.data[0], stats->_startTime, stats->_endTime);
+	record.data[1] = (endUserTime < startUserTime) ? 0 : (endUserTime - startUserTime);
+	record.data[2] = (endSystemTime < startSystemTime) ? 0 : (endSystemTime - startSystemTime);
+	record.data[3] = stats->_totalFreeHeapSize;
+	record.data[4] = stats->_totalHeapSize;
+	record.data[5] = _extensions->dispatcher->activeThreadCount();
+	publish(&record);
+}
+
+static void
+verboseEventStreamExclusiveStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventStream *)userData)->handleExclusiveStart(hook, eventNum, eventData);
+}
+
+static void
+verboseEventStreamExclusiveEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventStream *)userData)->handleExclusiveEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseEventStreamCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventStream *)userData)->handleCycleStart(hook, eventNum, eventData);
+}
+
+static void
+verboseEventStreamCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventStream *)userData)->handleCycleEnd(hook, eventNum, eventData);
+}
+
+static void
+verboseEventStreamGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventStream *)userData)->handleGCStart(hook, eventNum, eventData);
+}
+
+static void
+verboseEventStreamGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseEventStream *)userData)->handleGCEnd(hook, eventNum, eventData);
+}
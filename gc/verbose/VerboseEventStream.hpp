@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEEVENTSTREAM_HPP_)
+#define VERBOSEEVENTSTREAM_HPP_
+
+#include "omrcfg.h"
+#include "omr.h"
+#include "omrthread.h"
+#include "omrhookable.h"
+
+#include "Base.hpp"
+#include "modronbase.h"
+
+#include "VerboseEventRecord.hpp"
+
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+class MM_VerboseManager;
+
+/* Number of records the ring buffer can hold, must be a power of two */
+#define VERBOSE_EVENT_STREAM_RING_SIZE 4096
+/* Maximum number of records handed to a single file write */
+#define VERBOSE_EVENT_STREAM_WRITE_BATCH 64
+/* Period at which the flusher thread drains the ring buffer */
+#define VERBOSE_EVENT_STREAM_FLUSH_INTERVAL_MS 100
+
+/**
+ * Binary verbose GC output, used instead of the XML handler when -Xgc:binaryLogging is specified.
+ * GC threads reporting an event only format a fixed-size VerboseEventRecord and publish it into a
+ * bounded lock-free ring buffer; a background flusher thread drains the ring to the log file.
+ * Records that do not fit into a full ring are counted and reported as a single VERBOSE_EVENT_DROPPED record.
+ * The verbosegcconvert tool regenerates the XML stanzas from the resulting file.
+ * @ingroup GC_verbose_engine
+ */
+class MM_VerboseEventStream : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	typedef enum {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_RUNNING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED
+	} FlusherState;
+
+	MM_GCExtensionsBase *_extensions;
+	OMR_VM *_omrVM;
+	MM_VerboseManager *_manager; /**< Owning manager, holds the timestamps shared with the XML handler */
+	J9HookInterface** _mmPrivateHooks; /**< Pointers to the internal Hook interface */
+	J9HookInterface** _mmOmrHooks; /**< Pointers to the internal Hook interface */
+
+	intptr_t _logFileDescriptor; /**< Binary log file, -1 once closed */
+	VerboseEventRecord *_records; /**< Ring buffer slots */
+	volatile uintptr_t *_sequences; /**< Per slot sequence number, tells producers and the flusher who owns the slot */
+	volatile uintptr_t _enqueuePosition; /**< Next position to be claimed by a producer */
+	uintptr_t _dequeuePosition; /**< Next position to be written out, only touched by the flusher */
+	volatile uintptr_t _droppedRecords; /**< Records lost to a full ring since the last VERBOSE_EVENT_DROPPED record */
+
+	omrthread_monitor_t _flusherMonitor; /**< Guards _flusherState, producers never take it */
+	volatile FlusherState _flusherState;
+	VerboseEventRecord _writeBuffer[VERBOSE_EVENT_STREAM_WRITE_BATCH]; /**< Flusher staging area for batched writes */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	static int J9THREAD_PROC flusherThreadProc(void *info);
+	void flusherThreadEntryPoint();
+
+	/**
+	 * Start the flusher thread and wait for it to report that it is running.
+	 * @return true if the thread started
+	 */
+	bool startFlusher();
+
+	/**
+	 * Ask the flusher thread to drain the ring one last time and wait for it to exit.
+	 */
+	void stopFlusher();
+
+	/**
+	 * Write all records published so far to the log file. Called only by the flusher thread,
+	 * or after it has terminated.
+	 */
+	void drain();
+
+	/**
+	 * Publish a record into the ring. Never blocks: if the ring is full the record is dropped and counted.
+	 * @param record the record to copy into the ring
+	 */
+	void publish(VerboseEventRecord *record);
+
+	/**
+	 * Fill in the fields common to all records.
+	 */
+	void initRecord(VerboseEventRecord *record, VerboseEventType type, uintptr_t cycleType);
+
+	bool getTimeDeltaInMicroSeconds(uint64_t *timeInMicroSeconds, uint64_t startTime, uint64_t endTime);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, const char *filename);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_VerboseEventStream *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, const char *filename);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Register for the events recorded in the stream.
+	 */
+	void enableVerbose();
+
+	/**
+	 * Unregister from the events recorded in the stream.
+	 */
+	void disableVerbose();
+
+	/**
+	 * Stop the flusher thread, write out outstanding records and close the log file.
+	 * Events reported after this point are discarded.
+	 * @param env vm thread.
+	 */
+	void closeStream(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the stream still has an open log file
+	 */
+	MMINLINE bool isActive() { return -1 != _logFileDescriptor; }
+
+	void handleExclusiveStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleExclusiveEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleCycleStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleCycleEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleGCStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+	void handleGCEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
+	MM_VerboseEventStream(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+};
+
+#endif /* VERBOSEEVENTSTREAM_HPP_ */
@@ -21,6 +21,7 @@
  *******************************************************************************/
 
 #include "AllocateDescription.hpp"
+#include "AllocationSiteStats.hpp"
 #include "AllocationStats.hpp"
 #include "Dispatcher.hpp"
 #include "CycleState.hpp"
@@ -37,6 +38,7 @@
 
 static void verboseHandlerInitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void verboseHandlerHeapPreTouch(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutput::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -100,6 +102,7 @@ MM_VerboseHandlerOutput::enableVerbose()
 	/* Initialized */
 	(*_mmOmrHooks)->J9HookRegisterWithCallSite(_mmOmrHooks, J9HOOK_MM_OMR_INITIALIZED, verboseHandlerInitialized, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize, OMR_GET_CALLSITE(), (void *)this);
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_PRETOUCH, verboseHandlerHeapPreTouch, OMR_GET_CALLSITE(), (void *)this);
 
 	return ;
 }
@@ -110,6 +113,7 @@ MM_VerboseHandlerOutput::disableVerbose()
 	/* Initialized */
 	(*_mmOmrHooks)->J9HookUnregister(_mmOmrHooks, J9HOOK_MM_OMR_INITIALIZED, verboseHandlerInitialized, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_RESIZE, verboseHandlerHeapResize, NULL);
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_HEAP_PRETOUCH, verboseHandlerHeapPreTouch, NULL);
 
 	return ;
 }
@@ -764,11 +768,30 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+		if (1 < _extensions->tlhRefreshBatchCount) {
+			writer->formatAndOutput(env, 1, "<tlh-batching batched=\"%zu\" refreshes=\"%zu\" />", systemStats->_tlhBatchedCount, systemStats->_tlhRefreshCountBatched);
+		}
+#if defined(OMR_GC_BATCH_CLEAR_TLH)
+		if (_extensions->scavengerPreZeroAllocateSpace && (0 != _extensions->batchClearTLH)) {
+			writer->formatAndOutput(env, 1, "<tlh-prezeroed refreshes=\"%zu\" />", systemStats->_tlhRefreshCountPreZeroed);
+		}
+#endif /* defined(OMR_GC_BATCH_CLEAR_TLH) */
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
 	}
 
+	MM_AllocationSiteStats *allocationSiteStats = _extensions->allocationSiteStats;
+	if (NULL != allocationSiteStats) {
+		/* report the sites sampled since the previous report, then start over */
+		writer->formatAndOutput(env, 1, "<allocation-sites samples=\"%zu\" sampledBytes=\"%zu\">", allocationSiteStats->getSampleCount(), allocationSiteStats->getSampledBytes());
+		for (uintptr_t k = 1; k <= allocationSiteStats->getSiteCount(); k++) {
+			writer->formatAndOutput(env, 2, "<allocation-site token=\"%p\" bytes=\"%zu\" />", (void *)allocationSiteStats->getSite(k), allocationSiteStats->getSiteBytes(k));
+		}
+		writer->formatAndOutput(env, 1, "</allocation-sites>");
+		allocationSiteStats->clear();
+	}
+
 	if(0 != _extensions->bytesAllocatedMost){
 		const char *dots = "";
 		char escapedThreadName[128];
@@ -842,7 +865,11 @@ MM_VerboseHandlerOutput::handleGCEnd(J9HookInterface** hook, uintptr_t eventNum,
 	if (!getDurationTimeSuccessful || !getUserTimeSuccessful || !getSystemTimeSuccessful) {
 		writer->formatAndOutput(env, 0, "<warning details=\"clock error detected, following timing may be inaccurate\" />");
 	}
-	writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\">", tagTemplate, activeThreads);
+	if (0 != env->getExtensions()->gcThreadParkSpinCount) {
+		writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\" spinhandoffs=\"%zu\">", tagTemplate, activeThreads, env->getExtensions()->dispatcher->spinHandoffCount());
+	} else {
+		writer->formatAndOutput(env, 0, "<gc-end %s activeThreads=\"%zu\">", tagTemplate, activeThreads);
+	}
 	outputMemoryInfo(env, _manager->getIndentLevel() + 1, stats);
 	writer->formatAndOutput(env, 0, "</gc-end>");
 	exitAtomicReportingBlock();
@@ -938,6 +965,24 @@ MM_VerboseHandlerOutput::handleHeapResize(J9HookInterface** hook, uintptr_t even
 	exitAtomicReportingBlock();
 }
 
+void
+MM_VerboseHandlerOutput::handleHeapPreTouch(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_HeapPreTouchEvent * event = (MM_HeapPreTouchEvent *)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	uint64_t timeInMicroSeconds = event->timeTaken;
+	char tagTemplate[200];
+
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), _manager->getIdAndIncrement(), omrtime_current_time_millis());
+	writer->formatAndOutput(env, _manager->getIndentLevel(), "<heap-pretouch %s amount=\"%zu\" threads=\"%zu\" interleaved=\"%s\" timems=\"%llu.%03llu\" />",
+			tagTemplate, event->size, event->threadCount, event->interleaved ? "true" : "false", timeInMicroSeconds / 1000, timeInMicroSeconds % 1000);
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
 void
 MM_VerboseHandlerOutput::outputHeapResizeInfo(MM_EnvironmentBase *env, uintptr_t indent, HeapResizeType resizeType, uintptr_t resizeAmount, uintptr_t resizeCount, uintptr_t subSpaceType, uintptr_t reason, uint64_t timeInMicroSeconds)
 {
@@ -1059,3 +1104,9 @@ verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* event
 {
 	((MM_VerboseHandlerOutput*)userData)->handleHeapResize(hook, eventNum, eventData);
 }
+
+void
+verboseHandlerHeapPreTouch(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutput*)userData)->handleHeapPreTouch(hook, eventNum, eventData);
+}
@@ -28,6 +28,7 @@
 #include "GCExtensionsBase.hpp"
 #include "VerboseManager.hpp"
 
+#include "VerboseEventStream.hpp"
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseWriter.hpp"
@@ -104,6 +105,11 @@ void
 MM_VerboseManager::tearDown(MM_EnvironmentBase *env)
 {
 	disableVerboseGC();
+
+	if(NULL != _eventStream) {
+		_eventStream->kill(env);
+		_eventStream = NULL;
+	}
 	
 	if(NULL != _verboseHandlerOutput) {
 		_verboseHandlerOutput->kill(env);
@@ -138,13 +144,21 @@ MM_VerboseManager::closeStreams(MM_EnvironmentBase *env)
 		writer->closeStream(env);
 		writer = writer->getNextWriter();
 	}
+
+	if(NULL != _eventStream) {
+		_eventStream->closeStream(env);
+	}
 }
 
 void
 MM_VerboseManager::enableVerboseGC()
 {
 	if (!_hooksAttached) {
-		_verboseHandlerOutput->enableVerbose();
+		if (NULL != _eventStream) {
+			_eventStream->enableVerbose();
+		} else {
+			_verboseHandlerOutput->enableVerbose();
+		}
 		_hooksAttached = true;
 	}
 }
@@ -153,7 +167,11 @@ void
 MM_VerboseManager::disableVerboseGC()
 {
 	if (_hooksAttached) {
-		_verboseHandlerOutput->disableVerbose();
+		if (NULL != _eventStream) {
+			_eventStream->disableVerbose();
+		} else {
+			_verboseHandlerOutput->disableVerbose();
+		}
 		_hooksAttached = false;
 	}
 }
@@ -195,6 +213,10 @@ MM_VerboseManager::countActiveOutputHandlers()
 		writer = writer->getNextWriter();
 	}
 
+	if((NULL != _eventStream) && _eventStream->isActive()) {
+		count += 1;
+	}
+
 	return count;
 }
 
@@ -260,6 +282,11 @@ MM_VerboseManager::configureVerboseGC(OMR_VM *omrVM, char *filename, uintptr_t f
 
 	WriterType type = parseWriterType(&env, filename, fileCount, iterations);
 
+	if (env.getExtensions()->binaryLogging && ((VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS == type) || (VERBOSE_WRITER_FILE_LOGGING_BUFFERED == type))) {
+		/* binary records go straight to the file, none of the text writers are used */
+		return configureEventStream(&env, filename);
+	}
+
 	writer = findWriterInChain(type);
 
 	if (NULL != writer) {
@@ -280,6 +307,24 @@ MM_VerboseManager::configureVerboseGC(OMR_VM *omrVM, char *filename, uintptr_t f
 	return true;
 }
 
+bool
+MM_VerboseManager::configureEventStream(MM_EnvironmentBase *env, char *filename)
+{
+	bool hooksAttached = _hooksAttached;
+
+	/* the stream owns the hooks while it exists, detach them before swapping streams */
+	disableVerboseGC();
+	if (NULL != _eventStream) {
+		_eventStream->kill(env);
+	}
+	_eventStream = MM_VerboseEventStream::newInstance(env, this, filename);
+	if (hooksAttached) {
+		enableVerboseGC();
+	}
+
+	return NULL != _eventStream;
+}
+
 MM_VerboseWriter *
 MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *filename, uintptr_t fileCount, uintptr_t iterations)
 {
@@ -30,6 +30,7 @@
 #include "VerboseWriter.hpp"
 
 class MM_EnvironmentBase;
+class MM_VerboseEventStream;
 class MM_VerboseHandlerOutput;
 class MM_VerboseWriterChain;
 
@@ -50,6 +51,7 @@ private:
 protected:
 	MM_VerboseWriterChain* _writerChain; /**< The chain of writers for new verbose */
 	MM_VerboseHandlerOutput *_verboseHandlerOutput;  /**< New verbose format output handler */
+	MM_VerboseEventStream *_eventStream; /**< Binary event stream, replaces the output handler when -Xgc:binaryLogging is specified */
 
 public:
 	
@@ -93,6 +95,14 @@ protected:
 	 */
 	virtual WriterType parseWriterType(MM_EnvironmentBase *env, char *filename, uintptr_t fileCount, uintptr_t iterations);
 
+	/**
+	 * Open the binary event stream on the given file, replacing any stream opened before.
+	 * @param env A vm thread.
+	 * @param filename Filename for output
+	 * @return true on success, false if the file could not be opened
+	 */
+	virtual bool configureEventStream(MM_EnvironmentBase *env, char *filename);
+
 public:
 
 	/* Interface for Dynamic Configuration */
@@ -124,6 +134,7 @@ public:
 		: MM_VerboseManagerBase(omrVM)
 		, _writerChain(NULL)
 		, _verboseHandlerOutput(NULL)
+		, _eventStream(NULL)
 	{
 	}
 };
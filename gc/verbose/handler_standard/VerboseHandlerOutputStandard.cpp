@@ -25,10 +25,15 @@
 #include "omrgcconsts.h"
 #include "gcutils.h"
 
+#include "CardTable.hpp"
 #include "ConcurrentGCStats.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "MarkingScheme.hpp"
+#include "MarkMap.hpp"
+#include "MemoryManager.hpp"
+#include "ParallelGlobalGC.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -246,6 +251,40 @@ MM_VerboseHandlerOutputStandard::getCycleType(uintptr_t type)
 	return cycleType;
 }
 
+void
+MM_VerboseHandlerOutputStandard::handleInitializedInnerStanzas(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_InitializedEvent* event = (MM_InitializedEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+
+	/* The segregated heap shares this handler but its global collector is not an MM_ParallelGlobalGC */
+	if (!_extensions->isSegregatedHeap()) {
+		MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)_extensions->getGlobalCollector();
+		if (NULL != globalCollector) {
+			outputMetadataPages(env, "markMap", globalCollector->getMarkingScheme()->getMarkMap()->getMemoryHandle());
+		}
+	}
+	if (NULL != _extensions->cardTable) {
+		outputMetadataPages(env, "cardTable", _extensions->cardTable->getMemoryHandle());
+	}
+}
+
+void
+MM_VerboseHandlerOutputStandard::outputMetadataPages(MM_EnvironmentBase *env, const char *name, MM_MemoryHandle *handle)
+{
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_MemoryManager *memoryManager = _extensions->memoryManager;
+
+	if (NULL != memoryManager->getHeapBase(handle)) {
+		uintptr_t pageSize = memoryManager->getPageSize(handle);
+		uintptr_t size = (uintptr_t)memoryManager->getHeapTop(handle) - (uintptr_t)memoryManager->getHeapBase(handle);
+		/* Number of pages (and so TLB entries) needed to map the whole structure */
+		uintptr_t pageCount = (size + pageSize - 1) / pageSize;
+		writer->formatAndOutput(env, 1, "<attribute name=\"%sPageSize\" value=\"0x%zx\" />", name, pageSize);
+		writer->formatAndOutput(env, 1, "<attribute name=\"%sPageCount\" value=\"%zu\" />", name, pageCount);
+	}
+}
+
 void
 MM_VerboseHandlerOutputStandard::handleGCOPStanza(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess)
 {
@@ -304,6 +343,17 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+	if (0 != extensions->markingPrefetchDepth) {
+		writer->formatAndOutput(env, 1, "<scan-prefetch depth=\"%zu\" pipelined=\"%zu\" />",
+				OMR_MIN(extensions->markingPrefetchDepth, MARKING_PREFETCH_DEPTH_MAX), markStats->_objectsPipelined);
+	}
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (extensions->workStealingMark) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<work-stealing attempts=\"%zu\" stolen=\"%zu\" />",
+				workPacketStats->workPacketStealAttempts, workPacketStats->workPacketsStolen);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	handleMarkEndInternal(env, eventData);
 
@@ -329,7 +379,18 @@ MM_VerboseHandlerOutputStandard::handleSweepEnd(J9HookInterface** hook, uintptr_
 	bool deltaTimeSuccess = getTimeDeltaInMicroSeconds(&duration, sweepStats->_startTime, sweepStats->_endTime);
 
 	enterAtomicReportingBlock();
-	handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (extensions->lazySweepSegregated) {
+		MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+		handleGCOPOuterStanzaStart(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+		writer->formatAndOutput(env, 1, "<lazy-sweep pendingregions=\"%zu\" allocationswept=\"%zu\" completedregions=\"%zu\" />",
+				sweepStats->lazySweepPendingRegions, sweepStats->lazySweepAllocationSweptRegions, sweepStats->lazySweepCompletedRegions);
+		handleGCOPOuterStanzaEnd(env);
+	} else
+#endif /* OMR_GC_SEGREGATED_HEAP */
+	{
+		handleGCOPStanza(env, "sweep", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
+	}
 
 	handleSweepEndInternal(env, eventData);
 	exitAtomicReportingBlock();
@@ -379,6 +440,10 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		if (0 != (compactStats->_evacuatedSubAreas + compactStats->_fixupOnlySubAreas)) {
+			writer->formatAndOutput(env, 1, "<compact-window evacuatedsubareas=\"%zu\" fixuponlysubareas=\"%zu\" fragmentedbytes=\"%zu\" />",
+					compactStats->_evacuatedSubAreas, compactStats->_fixupOnlySubAreas, compactStats->_windowFragmentedBytes);
+		}
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -417,8 +482,17 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 	handleGCOPOuterStanzaStart(env, "scavenge", env->_cycleState->_verboseContextID, duration, deltaTimeSuccess);
 
 	if (event->cycleEnd) {
-		writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" />",
-				cycleScavengerStats->_tenureAge, cycleScavengerStats->getFlipHistory(0)->_tenureMask, cycleScavengerStats->_tiltRatio);
+		writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" threads=\"%zu\" />",
+				cycleScavengerStats->_tenureAge, cycleScavengerStats->getFlipHistory(0)->_tenureMask, cycleScavengerStats->_tiltRatio, cycleScavengerStats->_threadCount);
+		if (extensions->scavengerSurvivalCensus) {
+			outputSurvivalCensus(env, 1, cycleScavengerStats);
+		}
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		if (extensions->isConcurrentScavengerEnabled()) {
+			writer->formatAndOutput(env, 1, "<read-barrier healedobjects=\"%llu\" healedslots=\"%llu\" copied=\"%llu\" />",
+					cycleScavengerStats->_readObjectBarrierHeal, cycleScavengerStats->_readObjectBarrierUpdate, cycleScavengerStats->_readObjectBarrierCopy);
+		}
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 	}
 
 	if (0 != scavengerStats->_flipCount) {
@@ -437,6 +511,14 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (0 != scavengerStats->_referentCopyCount) {
+		writer->formatAndOutput(env, 1, "<copy-locality objects=\"%zu\" adjacent=\"%zu\" ratio=\"%.3f\" hotslotcopies=\"%zu\" />",
+				scavengerStats->_referentCopyCount, scavengerStats->_referentAdjacentCopyCount, scavengerStats->getReferentAdjacencyRatio(), scavengerStats->_hotSlotCopyCount);
+	}
+	if (extensions->numaAwareGencon) {
+		writer->formatAndOutput(env, 1, "<numa-copy crossnodeobjects=\"%zu\" crossnodebytes=\"%zu\" localscancaches=\"%zu\" remotescancaches=\"%zu\" />",
+				scavengerStats->_crossNodeCopyCount, scavengerStats->_crossNodeCopyBytes, scavengerStats->_localNodeScanCacheCount, scavengerStats->_remoteNodeScanCacheCount);
+	}
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -462,6 +544,31 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 	writer->flush(env);
 }
 
+void
+MM_VerboseHandlerOutputStandard::outputSurvivalCensus(MM_EnvironmentBase *env, uintptr_t indent, MM_ScavengerStats *scavengerStats)
+{
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+	uintptr_t totalBytes = 0;
+
+	for (uintptr_t age = 0; age < OMR_SCAVENGER_CENSUS_AGES; age++) {
+		for (uintptr_t sizeClass = 0; sizeClass < OMR_SCAVENGER_CENSUS_SIZE_CLASSES; sizeClass++) {
+			totalBytes += scavengerStats->_survivalCensus[age][sizeClass];
+		}
+	}
+
+	writer->formatAndOutput(env, indent, "<survival-census bytes=\"%zu\">", totalBytes);
+	for (uintptr_t age = 0; age < OMR_SCAVENGER_CENSUS_AGES; age++) {
+		for (uintptr_t sizeClass = 0; sizeClass < OMR_SCAVENGER_CENSUS_SIZE_CLASSES; sizeClass++) {
+			uintptr_t bytes = scavengerStats->_survivalCensus[age][sizeClass];
+			if (0 != bytes) {
+				writer->formatAndOutput(env, indent + 1, "<census-bucket age=\"%zu\" minsize=\"%zu\" bytes=\"%zu\" />",
+						age, MM_ScavengerStats::getSurvivalCensusSizeClassMinimum(sizeClass), bytes);
+			}
+		}
+	}
+	writer->formatAndOutput(env, indent, "</survival-census>");
+}
+
 void
 MM_VerboseHandlerOutputStandard::handleScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
 {
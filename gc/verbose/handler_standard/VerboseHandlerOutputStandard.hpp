@@ -31,6 +31,8 @@
 
 class MM_CollectionStatistics;
 class MM_EnvironmentBase;
+class MM_MemoryHandle;
+class MM_ScavengerStats;
 
 class MM_VerboseHandlerOutputStandard : public MM_VerboseHandlerOutput
 {
@@ -52,6 +54,22 @@ protected:
 	 */	
 	virtual const char *getCycleType(uintptr_t type);
 
+	/**
+	 * Output the pages backing the GC metadata (mark map and card table) for the initialized stanza.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	virtual void handleInitializedInnerStanzas(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
+	/**
+	 * Output the size and count of the pages backing a GC metadata structure.
+	 * @param env The current thread.
+	 * @param name The name of the structure.
+	 * @param handle The memory handle of the structure.
+	 */
+	void outputMetadataPages(MM_EnvironmentBase *env, const char *name, MM_MemoryHandle *handle);
+
 	void handleGCOPStanza(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess);
 	void handleGCOPOuterStanzaStart(MM_EnvironmentBase* env, const char *type, uintptr_t contextID, uint64_t duration, bool deltaTimeSuccess);
 	void handleGCOPOuterStanzaEnd(MM_EnvironmentBase* env);
@@ -131,6 +149,14 @@ public:
 	void handleScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 	void handleScavengeEndNoLock(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 
+	/**
+	 * Write the survival census of a scavenge cycle, one bucket per age and size class with surviving bytes.
+	 * @param env[in] The current thread.
+	 * @param indent[in] The current level of indentation.
+	 * @param scavengerStats[in] The cycle scavenger stats holding the merged census.
+	 */
+	void outputSurvivalCensus(MM_EnvironmentBase *env, uintptr_t indent, MM_ScavengerStats *scavengerStats);
+
 	/**
 	 * Write verbose stanza for a percolate event.
 	 * @param hook Hook interface used by the JVM.
@@ -401,7 +401,8 @@ typedef enum {
 	SCAV_RATIO_TOO_LOW,
 	HEAP_RESIZE,
 	SATISFY_EXPAND,
-	FORCED_NURSERY_CONTRACT
+	FORCED_NURSERY_CONTRACT,
+	SCAV_PAUSE_TOO_LONG
 } ContractReason;
 
 typedef enum {
@@ -412,7 +413,8 @@ typedef enum {
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
 	FORCED_NURSERY_EXPAND,
-	HINT_PREVIOUS_RUNS
+	HINT_PREVIOUS_RUNS,
+	SCAV_OVERHEAD_BUDGET_EXCEEDED
 } ExpandReason;
 
 typedef enum {
@@ -482,6 +484,8 @@ typedef enum {
 
 #define OMR_SCV_TENURE_RATIO_LOW 10
 #define OMR_SCV_TENURE_RATIO_HIGH 30
+/* Cohort survival rate at the tenure age above which the pause target controller promotes sooner, and below which it promotes later */
+#define OMR_SCV_PAUSE_TARGET_SURVIVAL_THRESHOLD 0.5
 #define OMR_SCV_REMSET_FRAGMENT_SIZE 32
 #define OMR_SCV_REMSET_SIZE 16384
 
@@ -1404,6 +1404,14 @@ omrthread_numa_set_enabled(BOOLEAN enabled);
 uintptr_t
 omrthread_numa_get_current_node();
 
+/**
+ * Gets the CPU the caller is being executed on.
+ * The result is only a hint, since the caller may be migrated to another CPU at any time.
+ * @return the CPU number, or -1 if it cannot be determined on this platform
+ */
+intptr_t
+omrthread_get_current_cpu(void);
+
 /* -------------- rasthrsup.c ------------------- */
 /**
  * @brief
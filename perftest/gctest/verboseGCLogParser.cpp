@@ -37,19 +37,32 @@ const char* XPATH_GET_ALL_MARK_TIME = "/verbosegc/gc-op[@type='mark']";
 const char* XPATH_GET_ALL_SWEEP_TIME = "/verbosegc/gc-op[@type='sweep']";
 const char* XPATH_GET_ALL_EXPAND_TIME = "/verbosegc/heap-resize[@type='expand']";
 const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
+const char* XPATH_GET_ALL_PAUSE_TIME = "/verbosegc/exclusive-end";
+const char* XPATH_GET_ALL_PAUSE_INTERVAL = "/verbosegc/exclusive-start";
+const char* XPATH_GET_ALL_ALLOCATED_BYTES = "/verbosegc/allocation-stats";
+const char* XPATH_GET_ALL_HEAP_AFTER_GC = "/verbosegc/gc-end/mem-info";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
+const char* DEFAULT_RESULT_FILE = "omrperfgctest_results.csv";
 
 double getAvg(std::vector<double> v);
-void analyze(char* fileName, OMRPortLibrary portLibrary);
-
-int main(void)
+double getPercentile(std::vector<double> v, double percentile);
+void analyze(char* fileName, OMRPortLibrary portLibrary, intptr_t resultFile);
+
+/**
+ * Analyze every verbose GC log in the current directory. Besides the human readable report, one line of
+ * comma separated results per log is written to the result file named by the first argument (default
+ * omrperfgctest_results.csv) so that runs can be compared for regressions.
+ */
+int main(int argc, char **argv)
 {
 	int32_t totalFiles = 0;
 	intptr_t rc = 0;
 	char resultBuffer[128];
 	uintptr_t rcFile;
 	uintptr_t handle;
+	intptr_t resultFile;
+	const char *resultFileName = (argc > 1) ? argv[1] : DEFAULT_RESULT_FILE;
 	OMRPortLibrary portLibrary;
 
 	rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
@@ -66,16 +79,25 @@ int main(void)
 
 	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 
+	resultFile = omrfile_open(resultFileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == resultFile) {
+		fprintf(stderr, "omrfile_open(%s) failed\n", resultFileName);
+		return -1;
+	}
+	omrfile_printf(resultFile, "log,pauses,p50_pause_ms,p90_pause_ms,p99_pause_ms,max_pause_ms,total_pause_ms,"
+			"elapsed_ms,mutator_utilization,allocated_bytes,allocation_rate_mb_s,max_heap_bytes,max_live_bytes,heap_overhead\n");
+
 	rcFile = handle = omrfile_findfirst(SRC_DIR, resultBuffer);
 
 	if(rcFile == (uintptr_t)-1) {
 		fprintf(stderr, "omrfile_findfirst(SRC_DIR, resultBuffer), return code=%d\n", (int)rcFile);
+		omrfile_close(resultFile);
 		return -1;
 	}
 
 	while ((uintptr_t)-1 != rcFile) {
 		if (strncmp(resultBuffer, VERBOSE_GC_FILE_PREFIX, strlen(VERBOSE_GC_FILE_PREFIX)) == 0) {
-			analyze(resultBuffer, portLibrary);
+			analyze(resultBuffer, portLibrary, resultFile);
 			totalFiles++;
 			/* Clean up verbose log file */
 			omrfile_unlink(resultBuffer);
@@ -89,6 +111,7 @@ int main(void)
 	if(totalFiles < 1) {
 		omrtty_printf("Failed to find any verbose GC file to process!\n\n");
 	}
+	omrfile_close(resultFile);
 
 	portLibrary.port_shutdown_library(&portLibrary);
 	omrthread_detach(NULL);
@@ -102,18 +125,37 @@ getAvg(std::vector<double> v)
 	return avg;
 }
 
+/**
+ * Nearest-rank percentile of a set of samples
+ */
+double
+getPercentile(std::vector<double> v, double percentile)
+{
+	std::sort(v.begin(), v.end());
+	size_t rank = (size_t)((percentile / 100.0) * v.size() + 0.5);
+	if (rank > 0) {
+		rank -= 1;
+	}
+	return v[std::min(rank, v.size() - 1)];
+}
+
 void
-analyze(char* fileName, OMRPortLibrary portLibrary)
+analyze(char* fileName, OMRPortLibrary portLibrary, intptr_t resultFile)
 {
 	std::vector<double> mark_values;
 	std::vector<double> sweep_values;
 	std::vector<double> expand_values;
 	std::vector<double> gcduration_values;
+	std::vector<double> pause_values;
 
 	pugi::xpath_node_set markTimes;
 	pugi::xpath_node_set sweepTimes;
 	pugi::xpath_node_set expandTimes;
 	pugi::xpath_node_set gcTimes;
+	pugi::xpath_node_set pauseTimes;
+	pugi::xpath_node_set pauseIntervals;
+	pugi::xpath_node_set allocationStats;
+	pugi::xpath_node_set heapAfterGC;
 
 	double maxMark = 0;
 	double minMark = 0;
@@ -131,6 +173,12 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double minGCDuration = 0;
 	double avgGCDuration = 0;
 
+	double elapsed = 0;
+	double totalPause = 0;
+	double allocatedBytes = 0;
+	double maxHeap = 0;
+	double maxLive = 0;
+
 	pugi::xml_document doc;
 	pugi::xml_parse_result result = doc.load_file(fileName);
 
@@ -170,6 +218,38 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	    gcduration_values.push_back(value);
 	}
 
+	/* Exclusive access covers the whole stop-the-world pause, not only the collection work inside it */
+	pauseTimes = doc.select_nodes(XPATH_GET_ALL_PAUSE_TIME);
+	for (pugi::xpath_node_set::const_iterator it = pauseTimes.begin(); it != pauseTimes.end(); ++it) {
+	    pugi::xpath_node node = *it;
+	    double value = node.node().attribute("durationms").as_double();
+	    pause_values.push_back(value);
+	    totalPause += value;
+	}
+
+	/* Exclusive starts are timed from the previous start, so their intervals add up to the run time until the last pause */
+	pauseIntervals = doc.select_nodes(XPATH_GET_ALL_PAUSE_INTERVAL);
+	for (pugi::xpath_node_set::const_iterator it = pauseIntervals.begin(); it != pauseIntervals.end(); ++it) {
+	    elapsed += it->node().attribute("intervalms").as_double();
+	}
+	if (!pause_values.empty()) {
+		elapsed += pause_values.back();
+	}
+
+	allocationStats = doc.select_nodes(XPATH_GET_ALL_ALLOCATED_BYTES);
+	for (pugi::xpath_node_set::const_iterator it = allocationStats.begin(); it != allocationStats.end(); ++it) {
+	    allocatedBytes += it->node().attribute("totalBytes").as_double();
+	}
+
+	/* Heap overhead is the committed heap relative to the largest live set seen after a collection */
+	heapAfterGC = doc.select_nodes(XPATH_GET_ALL_HEAP_AFTER_GC);
+	for (pugi::xpath_node_set::const_iterator it = heapAfterGC.begin(); it != heapAfterGC.end(); ++it) {
+	    double total = it->node().attribute("total").as_double();
+	    double live = total - it->node().attribute("free").as_double();
+	    maxHeap = std::max(maxHeap, total);
+	    maxLive = std::max(maxLive, live);
+	}
+
 	if (!mark_values.empty()) {
 		maxMark = *std::max_element(mark_values.begin(), mark_values.end());
 		minMark = *std::min_element(mark_values.begin(), mark_values.end());
@@ -204,4 +284,36 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 
 	omrtty_printf("Average : %f        %f        %f        %f\n\n",
 								avgMark, avgSweep, avgExpand, avgGCDuration);
+
+	if (!pause_values.empty()) {
+		size_t subMillisecondPauses = 0;
+		for (std::vector<double>::const_iterator it = pause_values.begin(); it != pause_values.end(); ++it) {
+			if (*it < 1.0) {
+				subMillisecondPauses += 1;
+			}
+		}
+
+		omrtty_printf("Pauses    Count     p50            p90            p99            Max\n");
+		omrtty_printf("-------------------------------------------------------------------\n");
+		omrtty_printf("          %-9zu %f       %f       %f       %f\n",
+								pause_values.size(), getPercentile(pause_values, 50), getPercentile(pause_values, 90),
+								getPercentile(pause_values, 99), *std::max_element(pause_values.begin(), pause_values.end()));
+		omrtty_printf("Pauses under 1 ms : %zu of %zu\n\n", subMillisecondPauses, pause_values.size());
+	}
+
+	double mutatorTime = elapsed - totalPause;
+	double mutatorUtilization = (elapsed > 0) ? (mutatorTime / elapsed) : 0;
+	double allocationRate = (mutatorTime > 0) ? ((allocatedBytes / (1024 * 1024)) / (mutatorTime / 1000)) : 0;
+	double heapOverhead = (maxLive > 0) ? (maxHeap / maxLive) : 0;
+
+	omrtty_printf("Elapsed : %f ms   Mutator utilization : %f   Allocation rate : %f MB/s   Heap overhead : %f\n\n",
+								elapsed, mutatorUtilization, allocationRate, heapOverhead);
+
+	omrfile_printf(resultFile, "%s,%zu,%f,%f,%f,%f,%f,%f,%f,%.0f,%f,%.0f,%.0f,%f\n",
+			fileName, pause_values.size(),
+			pause_values.empty() ? 0 : getPercentile(pause_values, 50),
+			pause_values.empty() ? 0 : getPercentile(pause_values, 90),
+			pause_values.empty() ? 0 : getPercentile(pause_values, 99),
+			pause_values.empty() ? 0 : *std::max_element(pause_values.begin(), pause_values.end()),
+			totalPause, elapsed, mutatorUtilization, allocatedBytes, allocationRate, maxHeap, maxLive, heapOverhead);
 }
@@ -42,8 +42,17 @@ endif
 
 all: test
 	
+PERFGCTEST_RESULT_FILE := omrperfgctest_results.csv
+PERFGCTEST_RESULT_COLUMNS := log,pauses,p50_pause_ms,p90_pause_ms,p99_pause_ms,max_pause_ms,total_pause_ms,elapsed_ms,mutator_utilization,allocated_bytes,allocation_rate_mb_s,max_heap_bytes,max_live_bytes,heap_overhead
+
+# The result file must have the expected header and one complete row for every verbose GC log the perf tests kept
 omr_perfgctest:
 	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
-	./omrperfgctest
+	logs=`ls VerboseGC* | wc -l`; \
+	./omrperfgctest $(PERFGCTEST_RESULT_FILE) && \
+	test "`head -n 1 $(PERFGCTEST_RESULT_FILE)`" = "$(PERFGCTEST_RESULT_COLUMNS)" && \
+	test `tail -n +2 $(PERFGCTEST_RESULT_FILE) | awk -F, 'NF == 14' | wc -l` -eq $$logs && \
+	test `tail -n +2 $(PERFGCTEST_RESULT_FILE) | wc -l` -eq $$logs || \
+	{ echo "$(PERFGCTEST_RESULT_FILE) does not hold one result row per verbose GC log"; exit 1; }
 
 .PHONY: all test omr_perfgctest 
@@ -352,3 +352,10 @@ omrthread_numa_get_current_node(){
 		return sradid + 1;
 	}
 }
+
+intptr_t
+omrthread_get_current_cpu(void)
+{
+	/* The current CPU is not queried on AIX */
+	return -1;
+}
@@ -144,3 +144,10 @@ uintptr_t
 omrthread_numa_get_current_node(){
 	return 0;
 }
+
+intptr_t
+omrthread_get_current_cpu(void)
+{
+	/* This is the common function, the current CPU is unknown */
+	return -1;
+}
@@ -103,6 +103,7 @@ omr_add_exports(j9thr_obj
 	omrthread_numa_set_enabled
 	omrthread_numa_set_node_affinity
 	omrthread_numa_get_node_affinity
+	omrthread_get_current_cpu
 	omrthread_map_native_priority
 	omrthread_set_priority_spread
 	omrthread_set_name
@@ -568,3 +568,16 @@ omrthread_numa_get_current_node()
 #endif
     return node;
 }
+
+intptr_t
+omrthread_get_current_cpu(void)
+{
+	intptr_t cpu = -1;
+#if !defined(OMRZTPF)
+	cpu = (intptr_t)sched_getcpu();
+	if (cpu < 0) {
+		cpu = -1;
+	}
+#endif /* !defined(OMRZTPF) */
+	return cpu;
+}
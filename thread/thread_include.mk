@@ -211,6 +211,7 @@ define WRITE_COMMON_THREAD_EXPORTS
 @echo omrthread_numa_set_enabled >>$@
 @echo omrthread_numa_set_node_affinity >>$@
 @echo omrthread_numa_get_node_affinity >>$@
+@echo omrthread_get_current_cpu >>$@
 @echo omrthread_map_native_priority >>$@
 @echo omrthread_set_priority_spread >>$@
 @echo omrthread_set_name >>$@
@@ -163,3 +163,17 @@ omrthread_numa_get_current_node()
 	}
 	return node;
 }
+
+intptr_t
+omrthread_get_current_cpu(void)
+{
+#if defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0601)
+	PROCESSOR_NUMBER processorNumber;
+	GetCurrentProcessorNumberEx(&processorNumber);
+	/* Processor groups hold up to 64 processors each */
+	return ((intptr_t)processorNumber.Group * 64) + processorNumber.Number;
+#else /* defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0601) */
+	/* GetCurrentProcessorNumberEx() needs Windows 7 */
+	return -1;
+#endif /* defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0601) */
+}
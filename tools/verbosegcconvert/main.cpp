@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Regenerates verbose GC XML from a binary event stream written with -Xgc:binaryLogging.
+ *
+ * usage: verbosegcconvert <binary log> [<xml output>]
+ *
+ * See MM_VerboseEventConverter for the stanzas produced.
+ */
+
+#include <stdio.h>
+
+#include "VerboseEventConverter.hpp"
+
+int
+main(int argc, char **argv)
+{
+	if ((argc < 2) || (argc > 3)) {
+		fprintf(stderr, "usage: %s <binary log> [<xml output>]\n", argv[0]);
+		return 1;
+	}
+
+	FILE *in = fopen(argv[1], "rb");
+	if (NULL == in) {
+		fprintf(stderr, "Failed to open %s\n", argv[1]);
+		return 1;
+	}
+
+	VerboseEventStreamHeader header;
+	MM_VerboseEventConverter::Result result = MM_VerboseEventConverter::readHeader(in, &header);
+	if (MM_VerboseEventConverter::NOT_BINARY_LOG == result) {
+		fprintf(stderr, "%s is not a binary verbose GC log\n", argv[1]);
+		fclose(in);
+		return 1;
+	}
+	if (MM_VerboseEventConverter::UNSUPPORTED_VERSION == result) {
+		fprintf(stderr, "%s has unsupported version %u (record size %u), expected version %u (record size %u)\n",
+				argv[1], header.version, header.recordSize, VERBOSE_EVENT_STREAM_VERSION, (uint32_t)sizeof(VerboseEventRecord));
+		fclose(in);
+		return 1;
+	}
+	rewind(in);
+
+	FILE *out = stdout;
+	if (3 == argc) {
+		out = fopen(argv[2], "w");
+		if (NULL == out) {
+			fprintf(stderr, "Failed to open %s\n", argv[2]);
+			fclose(in);
+			return 1;
+		}
+	}
+
+	MM_VerboseEventConverter::convert(in, out, &header);
+
+	fclose(in);
+	if (stdout != out) {
+		fclose(out);
+	}
+
+	return 0;
+}